@@ -1,8 +1,10 @@
 #include <benchmark/benchmark.h>
 #include <utility>
 #include <sstream>
+#include <list>
 
 #include <Lz.hpp>
+#include <Lz/FunctionTools.hpp>
 
 
 constexpr static size_t SizePolicy = 32;
@@ -40,6 +42,71 @@ static void Map(benchmark::State& state) {
     }
 }
 
+static void PipelineNested(benchmark::State& state) {
+    std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    auto pipeline = lz::filter(lz::filter(lz::map(lz::map(arr, [](const int i) { return i * 3; }),
+                                                  [](const int i) { return i + 1; }),
+                                          [](const int i) { return i % 2 == 0; }),
+                               [](const int i) { return i % 5 != 0; });
+
+    for (auto _ : state) {
+        for (const int i : pipeline) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+static void PipelineFused(benchmark::State& state) {
+    std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    auto pipeline = arr | lz::map([](const int i) { return i * 3; }) | lz::map([](const int i) { return i + 1; }) |
+                    lz::filter([](const int i) { return i % 2 == 0; }) | lz::filter([](const int i) { return i % 5 != 0; });
+
+    for (auto _ : state) {
+        for (const int i : pipeline) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+static void FilterOverMap(benchmark::State& state) {
+    std::array<std::string, SizePolicy> arr = lz::map(lz::range<int>(SizePolicy), [](const int i) {
+        return std::to_string(i * 1000);
+    }).toArray<SizePolicy>();
+    auto parsed = lz::map(arr, [](const std::string& s) { return std::stoi(s); });
+    auto filter = lz::filter(parsed, [](const int i) { return i % 3000 != 0; });
+
+    for (auto _ : state) {
+        for (const int i : filter) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+static void FilterRawLoop(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    const auto predicate = [](const int i) { return i != 0; };
+
+    for (auto _ : state) {
+        for (const int i : arr) {
+            if (predicate(i)) {
+                benchmark::DoNotOptimize(i);
+            }
+        }
+    }
+}
+
+static void MapRawLoop(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    const auto function = [](const int i) { return i == 0 ? 10 : 5; };
+
+    for (auto _ : state) {
+        for (const int i : arr) {
+            const int mapped = function(i);
+            benchmark::DoNotOptimize(mapped);
+        }
+    }
+}
+
 static void Range(benchmark::State& state) {
     for (auto _ : state) {
         auto range = lz::range(SizePolicy);
@@ -50,24 +117,56 @@ static void Range(benchmark::State& state) {
     }
 }
 
+static void RangeFloatingPointToVector(benchmark::State& state) {
+    auto range = lz::range(0., 1., 1. / SizePolicy);
+
+    for (auto _ : state) {
+        std::vector<double> grid = range.toVector();
+        benchmark::DoNotOptimize(grid);
+    }
+}
+
 static void StringSplitter(benchmark::State& state) {
     std::string toSplit = "hello hello hello hello hello he";
     auto splitter = lz::split(toSplit, " ");
 
     for (auto _ : state) {
-#ifdef CXX_LT_17
-        // making non const causes: benchmark/benchmark.h:322:48: internal compiler error: in assign_temp,
-        // at function.c:977
-        using StringType = const std::string&;
-#else
-        using StringType = const std::string_view;
-#endif
-        for (StringType substring : splitter) {
+        for (const lz::StringView substring : splitter) {
+            benchmark::DoNotOptimize(substring);
+        }
+    }
+}
+
+static std::string makeStringToSplit(const size_t tokenLength, const std::string& delimiter) {
+    std::string toSplit;
+    for (size_t i = 0; i < SizePolicy; i++) {
+        toSplit += std::string(tokenLength, 'a') + delimiter;
+    }
+    return toSplit;
+}
+
+static void splitString(benchmark::State& state, const std::string& toSplit, const std::string& delimiter) {
+    auto splitter = lz::split(toSplit, delimiter);
+
+    for (auto _ : state) {
+        for (const auto& substring : splitter) {
             benchmark::DoNotOptimize(substring);
         }
     }
 }
 
+static void StringSplitterShortTokens(benchmark::State& state) {
+    splitString(state, makeStringToSplit(4, "\n"), "\n");
+}
+
+static void StringSplitterLongTokens(benchmark::State& state) {
+    splitString(state, makeStringToSplit(512, "\n"), "\n");
+}
+
+static void StringSplitterMultiCharDelimiter(benchmark::State& state) {
+    splitString(state, makeStringToSplit(64, "\r\n"), "\r\n");
+}
+
 static void TakeWhile(benchmark::State& state) {
     std::array<int, SizePolicy> array = lz::range(static_cast<int>(SizePolicy)).toArray<SizePolicy>();
     auto takeWhile = lz::takewhile(array, [](const int i) { return i != SizePolicy - 1; });
@@ -163,6 +262,16 @@ static void Repeat(benchmark::State& state) {
     }
 }
 
+static void MeanOfTakeEveryRange(benchmark::State& state) {
+    int end = static_cast<int>(SizePolicy);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(end);
+        double mean = lz::mean(lz::takeevery(lz::range(end), 3));
+        benchmark::DoNotOptimize(mean);
+    }
+}
+
 static void TakeEvery(benchmark::State& state) {
     std::array<int, SizePolicy> array{};
     constexpr size_t offset = 2;
@@ -185,6 +294,16 @@ static void Random(benchmark::State& state) {
     }
 }
 
+static void RandomFill(benchmark::State& state) {
+    auto random = lz::random(0, 32, SizePolicy);
+    std::array<int, SizePolicy> buffer{};
+
+    for (auto _ : state) {
+        random.fill(buffer.begin(), buffer.size());
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
 static void DropWhile(benchmark::State& state) {
     int cnt = 0;
     std::array<int, SizePolicy> array = lz::generate([&cnt]() {
@@ -241,6 +360,41 @@ static void Concatenate(benchmark::State& state) {
     }
 }
 
+static void ConcatenateChunked(benchmark::State& state) {
+    std::string a(SizePolicy / 2, '0');
+    std::string b(SizePolicy / 2, '1');
+    auto concatenate = lz::concat(a, b);
+
+    for (auto _ : state) {
+        concatenate.forEachChunk([](const char* data, const size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                benchmark::DoNotOptimize(data[i]);
+            }
+        });
+    }
+}
+
+static void ConcatenateSegments(benchmark::State& state) {
+    std::vector<int> a(SizePolicy / 4, 0), b(SizePolicy / 4, 1), c(SizePolicy / 4, 2), d(SizePolicy / 4, 3);
+    auto concatenate = lz::concat(a, b, c, d);
+
+    for (auto _ : state) {
+        for (const int i : concatenate) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+static void ConcatenateSegmentsSum(benchmark::State& state) {
+    std::vector<int> a(SizePolicy / 4, 0), b(SizePolicy / 4, 1), c(SizePolicy / 4, 2), d(SizePolicy / 4, 3);
+    auto concatenate = lz::concat(a, b, c, d);
+
+    for (auto _ : state) {
+        int sum = lz::transaccumulate(concatenate, 0, [](const int i) { return i; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
 static void Unique(benchmark::State& state) {
     std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
     auto unique = lz::unique(arr);
@@ -252,6 +406,30 @@ static void Unique(benchmark::State& state) {
     }
 }
 
+static void UniqueUnsorted(benchmark::State& state) {
+    std::array<int, SizePolicy> shuffled = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    std::reverse(shuffled.begin(), shuffled.end());
+
+    for (auto _ : state) {
+        // lz::unique sorts the sequence it is given, so it has to work on a copy to leave the input intact
+        std::array<int, SizePolicy> arr = shuffled;
+        for (const int i : lz::unique(arr)) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+static void UniqueHashed(benchmark::State& state) {
+    std::array<int, SizePolicy> shuffled = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    std::reverse(shuffled.begin(), shuffled.end());
+
+    for (auto _ : state) {
+        for (const int i : lz::uniqueHashed(shuffled)) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
 static void JoinInt(benchmark::State& state) {
     std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
     auto join = lz::join(arr, ",");
@@ -274,25 +452,144 @@ static void JoinString(benchmark::State& state) {
     }
 }
 
+static void JoinToString(benchmark::State& state) {
+    std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    std::string joined;
+
+    for (auto _ : state) {
+        joined.clear();
+        lz::joinTo(arr, joined, ",");
+        benchmark::DoNotOptimize(joined);
+    }
+}
+
+static void RangeToString(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        std::string string = range.toString(", ");
+        benchmark::DoNotOptimize(string);
+    }
+}
+
+static void AggregateBy(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        auto sums = lz::aggregateBy(range, [](const int i) { return i % 8; }, 0, [](const int sum, const int i) {
+            return sum + i;
+        });
+        benchmark::DoNotOptimize(sums);
+    }
+}
+
+static void AggregateByUnorderedMap(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        std::unordered_map<int, int> sums;
+        for (const int i : range) {
+            sums[i % 8] += i;
+        }
+        benchmark::DoNotOptimize(sums);
+    }
+}
+
+static void GroupBySorted(benchmark::State& state) {
+    std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
+    auto groups = lz::groupBySorted(arr, [](const int i) { return i / 4; });
+
+    for (auto _ : state) {
+        for (const auto& group : groups) {
+            benchmark::DoNotOptimize(group);
+        }
+    }
+}
+
+static void ToListHeap(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        auto list = range.to<std::list>();
+        benchmark::DoNotOptimize(list);
+    }
+}
+
+static void ToListArena(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+    lz::Arena arena;
+
+    for (auto _ : state) {
+        {
+            auto list = range.to<std::list>(arena.allocator<int>());
+            benchmark::DoNotOptimize(list);
+        }
+        arena.release();
+    }
+}
+
+static void ToUnorderedMap(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        auto map = range.toUnorderedMap([](const int i) { return i % 16; });
+        benchmark::DoNotOptimize(map);
+    }
+}
+
+static void ToFlatMap(benchmark::State& state) {
+    auto range = lz::range(static_cast<int>(SizePolicy));
+
+    for (auto _ : state) {
+        auto map = range.toFlatMap([](const int i) { return i % 16; });
+        benchmark::DoNotOptimize(map);
+    }
+}
+
+BENCHMARK(AggregateBy);
+BENCHMARK(AggregateByUnorderedMap);
 BENCHMARK(Choose);
 BENCHMARK(Concatenate);
+BENCHMARK(ConcatenateChunked);
+BENCHMARK(ConcatenateSegments);
+BENCHMARK(ConcatenateSegmentsSum);
 BENCHMARK(DropWhile);
 BENCHMARK(Enumerate);
 BENCHMARK(Except);
 BENCHMARK(Filter);
+BENCHMARK(FilterRawLoop);
+BENCHMARK(FilterOverMap);
+BENCHMARK(PipelineNested);
+BENCHMARK(PipelineFused);
 BENCHMARK(Generate);
+BENCHMARK(GroupBySorted);
 BENCHMARK(JoinInt);
 BENCHMARK(JoinString);
+BENCHMARK(JoinToString);
+BENCHMARK(RangeToString);
 BENCHMARK(Map);
+BENCHMARK(MapRawLoop);
 BENCHMARK(Range);
+BENCHMARK(RangeFloatingPointToVector);
 BENCHMARK(Random);
+BENCHMARK(RandomFill);
 BENCHMARK(Repeat);
+BENCHMARK(MeanOfTakeEveryRange);
 BENCHMARK(StringSplitter);
+BENCHMARK(StringSplitterShortTokens);
+BENCHMARK(StringSplitterLongTokens);
+BENCHMARK(StringSplitterMultiCharDelimiter);
 BENCHMARK(Take);
 BENCHMARK(TakeWhile);
 BENCHMARK(TakeEvery);
 BENCHMARK(Slice);
+BENCHMARK(ToListHeap);
+BENCHMARK(ToListArena);
+BENCHMARK(ToUnorderedMap);
+BENCHMARK(ToFlatMap);
 BENCHMARK(Unique);
+BENCHMARK(UniqueUnsorted);
+BENCHMARK(UniqueHashed);
 BENCHMARK(Zip4);
 BENCHMARK(Zip3);
 BENCHMARK(Zip2);
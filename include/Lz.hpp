@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Lz/Affirm.hpp>
+#include <Lz/Arena.hpp>
 #include <Lz/Choose.hpp>
 #include <Lz/Concatenate.hpp>
 #include <Lz/DropWhile.hpp>
@@ -8,13 +9,18 @@
 #include <Lz/Except.hpp>
 #include <Lz/Filter.hpp>
 #include <Lz/Generate.hpp>
+#include <Lz/GroupBy.hpp>
 #include <Lz/Join.hpp>
 #include <Lz/Map.hpp>
+#include <Lz/MappedFile.hpp>
 #include <Lz/Random.hpp>
 #include <Lz/Range.hpp>
 #include <Lz/Repeat.hpp>
+#include <Lz/StreamSplitter.hpp>
 #include <Lz/StringSplitter.hpp>
+#include <Lz/StringView.hpp>
 #include <Lz/Take.hpp>
 #include <Lz/TakeEvery.hpp>
 #include <Lz/Unique.hpp>
+#include <Lz/UniqueHashed.hpp>
 #include <Lz/Zip.hpp>
@@ -7,14 +7,14 @@
 
 namespace lz {
     template<class Exception, class Iterator, class Function>
-    class Affirm final : public detail::BasicIteratorView<detail::AffirmIterator<Exception, Iterator, Function>> {
+    class Affirm final : public detail::BasicIteratorView<Affirm<Exception, Iterator, Function>, detail::AffirmIterator<Exception, Iterator, Function>> {
     public:
         using iterator = detail::AffirmIterator<Exception, Iterator, Function>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
     private:
-        detail::AffirmIteratorHelper<Iterator, Exception, value_type> _helper{};
+        detail::AffirmIteratorHelper<Function, Exception> _helper{};
         Iterator _begin{};
         Iterator _end{};
 
@@ -31,7 +31,7 @@ namespace lz {
          * `exception` is thrown.
          */
         Affirm(const Iterator begin, const Iterator end, Exception&& exception, const Function& predicate) :
-            _helper{predicate, std::forward<Exception>(exception)},
+            _helper{detail::FunctionContainer<Function>(predicate), std::forward<Exception>(exception)},
             _begin(begin),
             _end(end) {}
 
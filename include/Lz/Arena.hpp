@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#if defined(__has_include) && __cplusplus >= 201703L
+  #if __has_include(<memory_resource>)
+    #include <memory_resource>
+    #define LZ_HAS_MEMORY_RESOURCE
+  #endif
+#endif
+
+
+namespace lz {
+    template<class T>
+    class ArenaAllocator;
+
+    /**
+     * A monotonic (bump) allocator. Allocating moves a pointer forward in the current block, deallocating does nothing, and
+     * `release()` or the destructor frees all memory at once. Give every materializer of a pipeline an allocator of the
+     * same arena, e.g. `view.toVector(arena.allocator<int>())`, so that the temporaries of e.g. one request are freed in
+     * one go at the end of it. In C++17 the arena is also a `std::pmr::memory_resource`. An arena is not thread safe.
+     */
+#ifdef LZ_HAS_MEMORY_RESOURCE
+    class Arena final : public std::pmr::memory_resource {
+#else
+    class Arena final {
+#endif
+        struct Block {
+            Block* previous;
+        };
+
+        // Blocks are aligned for every fundamental type, as their storage starts right after this header
+        static constexpr std::size_t HeaderSize = (sizeof(Block) + alignof(std::max_align_t) - 1) &
+                                                  ~(alignof(std::max_align_t) - 1);
+
+        Block* _blocks{};
+        char* _position{};
+        char* _blockEnd{};
+        char* _buffer{};
+        std::size_t _bufferSize{};
+        std::size_t _initialBlockSize{};
+        std::size_t _nextBlockSize{};
+
+        // The amount of bytes from `pointer` to the next address that is a multiple of `alignment`
+        static std::size_t paddingOf(const char* pointer, const std::size_t alignment) {
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+            return static_cast<std::size_t>((alignment - address % alignment) % alignment);
+        }
+
+        // Whether `bytes` aligned to `alignment` fit in the rest of the current block. The padding is compared before it is
+        // applied, as it may be larger than the space that is left.
+        bool fits(const std::size_t bytes, const std::size_t alignment) const {
+            if (_position == nullptr) {
+                return false;
+            }
+            const std::size_t left = static_cast<std::size_t>(_blockEnd - _position);
+            const std::size_t padding = paddingOf(_position, alignment);
+            return padding <= left && left - padding >= bytes;
+        }
+
+        // Every block is twice as large as the previous one, so that n bytes take O(log n) blocks
+        void addBlock(const std::size_t bytes, const std::size_t alignment) {
+            std::size_t size = _nextBlockSize;
+            while (size < bytes + alignment) {
+                size *= 2;
+            }
+
+            Block* block = static_cast<Block*>(::operator new(HeaderSize + size));
+            block->previous = _blocks;
+            _blocks = block;
+            _position = reinterpret_cast<char*>(block) + HeaderSize;
+            _blockEnd = _position + size;
+            _nextBlockSize = size * 2;
+        }
+
+    public:
+        static constexpr std::size_t DefaultBlockSize = 4096;
+
+        /**
+         * @brief Creates an arena that allocates blocks of at least `blockSize` bytes from the global heap.
+         * @param blockSize The size of the first block, every next block is twice as large.
+         */
+        explicit Arena(const std::size_t blockSize = DefaultBlockSize) :
+            _initialBlockSize(blockSize > 0 ? blockSize : 1),
+            _nextBlockSize(_initialBlockSize) {
+        }
+
+        /**
+         * @brief Creates an arena that allocates from `buffer` first, e.g. an array on the stack, and from the global heap
+         * when it is full. The buffer must outlive the arena.
+         * @param buffer The memory to allocate from first.
+         * @param size The size of `buffer` in bytes.
+         */
+        Arena(void* buffer, const std::size_t size) :
+            _position(static_cast<char*>(buffer)),
+            _blockEnd(static_cast<char*>(buffer) + size),
+            _buffer(static_cast<char*>(buffer)),
+            _bufferSize(size),
+            _initialBlockSize(size > 0 ? size : std::size_t(DefaultBlockSize)),
+            _nextBlockSize(_initialBlockSize) {
+        }
+
+        Arena(const Arena&) = delete;
+
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena() {
+            release();
+        }
+
+        /**
+         * @brief Returns `bytes` bytes aligned to `alignment`, which must be a power of two.
+         */
+        void* allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+            if (!fits(bytes, alignment)) {
+                addBlock(bytes, alignment);
+            }
+            char* result = _position + paddingOf(_position, alignment);
+            _position = result + bytes;
+            return result;
+        }
+
+        /**
+         * @brief Does nothing, memory is only given back by `release()`.
+         */
+        void deallocate(void* /*pointer*/, const std::size_t /*bytes*/, const std::size_t /*alignment*/ = 0) noexcept {
+        }
+
+        /**
+         * @brief Frees all memory that was allocated from the heap. Everything that was allocated from this arena must not be
+         * used anymore. The arena can be used again afterwards, starting with its buffer if it was given one.
+         */
+        void release() noexcept {
+            while (_blocks != nullptr) {
+                Block* previous = _blocks->previous;
+                ::operator delete(_blocks);
+                _blocks = previous;
+            }
+            _position = _buffer;
+            _blockEnd = _buffer == nullptr ? nullptr : _buffer + _bufferSize;
+            _nextBlockSize = _initialBlockSize;
+        }
+
+        /**
+         * @brief Returns an STL allocator that allocates from this arena.
+         */
+        template<class T>
+        ArenaAllocator<T> allocator() noexcept;
+
+#ifdef LZ_HAS_MEMORY_RESOURCE
+    private:
+        void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+            return allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* /*pointer*/, const std::size_t /*bytes*/, const std::size_t /*alignment*/) override {
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+#endif
+    };
+
+    /**
+     * An STL allocator that allocates from an `lz::Arena`. It can be passed to every materializer that takes an allocator,
+     * such as `toVector`, `to<Container>`, `toMap`, `toUnorderedMap`, `toFlatMap` and `toString`. The arena must outlive
+     * everything that was allocated from it.
+     */
+    template<class T>
+    class ArenaAllocator {
+        Arena* _arena;
+
+        template<class U>
+        friend class ArenaAllocator;
+
+    public:
+        using value_type = T;
+
+        ArenaAllocator(Arena& arena) noexcept : // NOLINT(google-explicit-constructor)
+            _arena(&arena) {
+        }
+
+        template<class U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : // NOLINT(google-explicit-constructor)
+            _arena(other._arena) {
+        }
+
+        T* allocate(const std::size_t count) {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* /*pointer*/, const std::size_t /*count*/) noexcept {
+        }
+
+        Arena& arena() const noexcept {
+            return *_arena;
+        }
+
+        template<class U>
+        friend bool operator==(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept {
+            return &lhs.arena() == &rhs.arena();
+        }
+
+        template<class U>
+        friend bool operator!=(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+
+    template<class T>
+    ArenaAllocator<T> Arena::allocator() noexcept {
+        return ArenaAllocator<T>(*this);
+    }
+}
@@ -7,7 +7,7 @@
 
 namespace lz {
     template<class Iterator, class Function>
-    class Choose final : public detail::BasicIteratorView<detail::ChooseIterator<Iterator, Function>> {
+    class Choose final : public detail::BasicIteratorView<Choose<Iterator, Function>, detail::ChooseIterator<Iterator, Function>> {
     public:
         using iterator = detail::ChooseIterator<Iterator, Function>;
         using const_iterator = iterator;
@@ -18,12 +18,11 @@ namespace lz {
         using FunctionParamType = decltype(*std::declval<Iterator>());
         using Pair = detail::FunctionReturnType<Function, FunctionParamType>;
         using FunctionReturnValuePairSecond = typename Pair::second_type;
-        using ChooseFunction = std::function<Pair(FunctionParamType)>;
 
         static_assert(std::is_same<std::pair<bool, FunctionReturnValuePairSecond>, Pair>::value,
                       "function must return type std::pair<bool T>");
 
-        ChooseFunction _func{};
+        detail::FunctionContainer<Function> _func{};
         Iterator _begin;
         Iterator _end;
 
@@ -47,16 +46,24 @@ namespace lz {
          * @brief Returns the beginning of the sequence.
          * @return The beginning of the sequence.
          */
-        iterator begin() const override {
-            return iterator(_begin, _end, &_func);
+        iterator begin() const {
+            return iterator(_begin, _end, _func);
         }
 
         /**
          * @brief Returns the ending of the sequence.
          * @return The ending of the sequence.
          */
-        iterator end() const override {
-            return iterator(_end, _end, &_func);
+        iterator end() const {
+            return iterator(_end, _end, _func);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, the length of the sequence that is chosen from.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
         }
     };
 
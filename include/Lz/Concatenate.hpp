@@ -18,7 +18,7 @@ namespace lz {
     }
 
     template<class... Iterators>
-    class Concatenate final : public detail::BasicIteratorView<detail::ConcatenateIterator<Iterators...>> {
+    class Concatenate final : public detail::BasicIteratorView<Concatenate<Iterators...>, detail::ConcatenateIterator<Iterators...>> {
     public:
         using iterator = detail::ConcatenateIterator<Iterators...>;
         using const_iterator = iterator;
@@ -46,7 +46,7 @@ namespace lz {
          * @brief Returns the beginning of the iterator.
          * @return The beginning of the iterator.
          */
-        iterator begin() const override {
+        iterator begin() const {
             return iterator(_begin, _begin, _end);
         }
 
@@ -54,7 +54,7 @@ namespace lz {
          * @brief Returns the ending of the iterator.
          * @return The ending of the iterator.
          */
-        iterator end() const override {
+        iterator end() const {
             return iterator(_end, _begin, _end);
         }
     };
@@ -1,49 +1,51 @@
 #pragma once
 
-#include "detail/DropWhileIterator.hpp"
+#include <algorithm>
+
 #include "detail/BasicIteratorView.hpp"
 
 
 namespace lz {
     template<class Iterator, class Function>
-    class DropWhile final : public detail::BasicIteratorView<detail::DropWhileIterator<Iterator, Function>> {
+    class DropWhile final : public detail::BasicIteratorView<DropWhile<Iterator, Function>, Iterator> {
     public:
-        using iterator = detail::DropWhileIterator<Iterator, Function>;
+        using iterator = Iterator;
         using const_iterator = iterator;
 
-        using value_type = typename iterator::value_type;
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
 
     private:
-        iterator _begin{};
-        iterator _end{};
+        Iterator _begin{};
+        Iterator _end{};
 
     public:
         /**
          * @brief Creates a DropWhile iterator view object.
          * @details This iterator view object can be used to skip values while `predicate` returns true. After the `predicate` returns
-         * false, no more values are being skipped.
+         * false, no more values are being skipped. The values are skipped here, so iterating over this view is the same as
+         * iterating over the rest of [begin, end).
          * @param begin The beginning of the sequence.
          * @param end The ending of the sequence.
          * @param predicate Function that must return `bool`, and take a `Iterator::value_type` as function parameter.
          */
         DropWhile(const Iterator begin, const Iterator end, const Function& predicate) :
-            _begin(begin, end, predicate),
-            _end(end, end, predicate) {
+            _begin(std::find_if(begin, end, [&predicate](const value_type& value) { return !predicate(value); })),
+            _end(end) {
         }
 
         DropWhile() = default;
 
         /**
-         * @brief Returns the beginning of the enumerate iterator object.
-         * @return A random access DropWhile.
+         * @brief Returns the beginning of the sequence, the first element for which the predicate returned false.
+         * @return The beginning of the sequence.
          */
         iterator begin() const {
             return _begin;
         }
 
         /**
-         * @brief Returns the ending of the enumerate object.
-         * @return A random access DropWhile.
+         * @brief Returns the ending of the sequence.
+         * @return The ending of the sequence.
          */
         iterator end() const {
             return _end;
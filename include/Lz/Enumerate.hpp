@@ -10,7 +10,7 @@
 
 namespace lz {
     template<class Iterator, class IntType>
-    class Enumerate final : public detail::BasicIteratorView<detail::EnumerateIterator<Iterator, IntType>> {
+    class Enumerate final : public detail::BasicIteratorView<Enumerate<Iterator, IntType>, detail::EnumerateIterator<Iterator, IntType>> {
     public:
         using iterator = detail::EnumerateIterator<Iterator, IntType>;
         using const_iterator = iterator;
@@ -39,7 +39,7 @@ namespace lz {
          * @brief Returns the beginning of the enumerate iterator object.
          * @return A random access EnumerateIterator.
          */
-        iterator begin() const override {
+        iterator begin() const {
             return _begin;
         }
 
@@ -47,7 +47,7 @@ namespace lz {
          * @brief Returns the ending of the enumerate object.
          * @return A random access EnumerateIterator.
          */
-        iterator end() const override {
+        iterator end() const {
             return _end;
         }
     };
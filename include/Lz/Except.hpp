@@ -6,30 +6,36 @@
 
 
 namespace lz {
-    template<class Iterator, class IteratorToExcept>
-    class Except final : public detail::BasicIteratorView<detail::ExceptIterator<Iterator, IteratorToExcept>> {
+    template<class Iterator, class IteratorToExcept, class Allocator>
+    class Except final : public detail::BasicIteratorView<Except<Iterator, IteratorToExcept, Allocator>,
+                                                          detail::ExceptIterator<Iterator, IteratorToExcept, Allocator>> {
     public:
-        using iterator = detail::ExceptIterator<Iterator, IteratorToExcept>;
+        using iterator = detail::ExceptIterator<Iterator, IteratorToExcept, Allocator>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
     private:
-        mutable detail::ExceptIteratorHelper<Iterator, IteratorToExcept> _iteratorHelper;
+        detail::ExceptIteratorHelper<Iterator, IteratorToExcept, Allocator> _iteratorHelper;
         Iterator _begin{};
         Iterator _end{};
 
     public:
         /**
-         * Except constructor. Excepts all elements between [begin, end) contained by [toExceptBegin, toExceptEnd)
+         * Except constructor. Excepts all elements between [begin, end) contained by [toExceptBegin, toExceptEnd). Reads
+         * [toExceptBegin, toExceptEnd) into a lookup structure once, the sequence itself is left untouched.
          * @param begin The beginning of the iterator to skip.
          * @param end The ending of the iterator to skip.
          * @param toExceptBegin The beginning of the actual elements to except.
          * @param toExceptEnd The ending of the actual elements to except.
+         * @param allocator The allocator of the lookup structure.
          */
-        Except(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin, const IteratorToExcept toExceptEnd) :
-            _iteratorHelper{toExceptBegin, toExceptEnd, end, false},
+        Except(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin, const IteratorToExcept toExceptEnd,
+               const Allocator& allocator) :
+            _iteratorHelper(end, allocator),
             _begin(begin),
-            _end(end) {}
+            _end(end) {
+            _iteratorHelper.exclusionSet.assign(toExceptBegin, toExceptEnd);
+        }
 
         Except() = default;
 
@@ -37,17 +43,24 @@ namespace lz {
          * Returns an iterator to the beginning.
          * @return An iterator to the beginning.
          */
-        iterator begin() const override {
-            _iteratorHelper.isSorted = std::is_sorted(_iteratorHelper.toExceptBegin, _iteratorHelper.toExceptEnd);
-            return iterator(_begin, _end, &_iteratorHelper);
+        iterator begin() const {
+            return iterator(_begin, &_iteratorHelper);
         }
 
         /**
          * Returns an iterator to the ending.
          * @return An iterator to the ending.
          */
-        iterator end() const override {
-            return iterator(_end, _end, &_iteratorHelper);
+        iterator end() const {
+            return iterator(_end, &_iteratorHelper);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, the length of the sequence that is excepted from.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
         }
     };
 
@@ -57,37 +70,45 @@ namespace lz {
      */
 
     /**
-     * @brief This function returns a view to the random access ExceptIterator.
+     * @brief This function returns a view to the ExceptIterator.
      * @details This iterator can be used to 'remove'/'except' elements in range from [`begin`, `end`) contained by
-     * [`toExceptBegin`, `toExceptEnd).
+     * [`toExceptBegin`, `toExceptEnd). The elements to except are put in a bitset (integers that lie close together), a
+     * hash set, or, if they cannot be hashed with `std::hash`, a sorted vector, so every element is looked up in constant
+     * or logarithmic time. Neither range needs to be sorted and neither range is modified.
      * @tparam Iterator Is automatically deduced.
      * @tparam IteratorToExcept Is automatically deduced.
      * @param begin The beginning of the iterator to except elements from contained by [`toExceptBegin`, `toExceptEnd).
      * @param end The ending of the iterator to except elements from contained by [`toExceptBegin`, `toExceptEnd).
      * @param toExceptBegin The beginning of the iterator, containing items that must be removed from [`begin`, `end`).
      * @param toExceptEnd The ending of the iterator, containing items that must be removed from [`begin`, `end`).
+     * @param allocator Optional, the allocator of the lookup structure, e.g. an `lz::ArenaAllocator`.
      * @return An Except view object.
      */
-    template<class Iterator, class IteratorToExcept>
-    Except<Iterator, IteratorToExcept> exceptrange(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin,
-                                                   const IteratorToExcept toExceptEnd) {
-        return Except<Iterator, IteratorToExcept>(begin, end, toExceptBegin, toExceptEnd);
+    template<class Iterator, class IteratorToExcept,
+        class Allocator = std::allocator<typename std::iterator_traits<IteratorToExcept>::value_type>>
+    Except<Iterator, IteratorToExcept, Allocator>
+    exceptrange(const Iterator begin, const Iterator end, const IteratorToExcept toExceptBegin, const IteratorToExcept toExceptEnd,
+                const Allocator& allocator = Allocator()) {
+        return Except<Iterator, IteratorToExcept, Allocator>(begin, end, toExceptBegin, toExceptEnd, allocator);
     }
 
     /**
-     * @brief This function returns a view to the random access ExceptIterator.
-     * @details This iterator can be used to 'remove'/'except' elements in `iterable` contained by `toExcept`. If `toExcept` is sorted
-     * and has an `operator<`
+     * @brief This function returns a view to the ExceptIterator.
+     * @details This iterator can be used to 'remove'/'except' elements in `iterable` contained by `toExcept`. The elements
+     * to except are put in a bitset, a hash set or a sorted vector, so neither sequence needs to be sorted and neither
+     * sequence is modified.
      * @tparam Iterable Is automatically deduced.
      * @tparam IterableToExcept Is automatically deduced.
      * @param iterable The iterable to except elements from contained by `toExcept`.
      * @param toExcept The iterable containing items that must be removed from [`begin`, `end`).
+     * @param allocator Optional, the allocator of the lookup structure, e.g. an `lz::ArenaAllocator`.
      * @return An Except view object.
      */
-    template<class Iterable, class IterableToExcept>
-    auto except(Iterable&& iterable, IterableToExcept&& toExcept) ->
-    Except<decltype(std::begin(iterable)), decltype(std::begin(toExcept))> {
-        return exceptrange(std::begin(iterable), std::end(iterable), std::begin(toExcept), std::end(toExcept));
+    template<class Iterable, class IterableToExcept,
+        class Allocator = std::allocator<detail::ValueTypeIterable<IterableToExcept>>>
+    auto except(Iterable&& iterable, IterableToExcept&& toExcept, const Allocator& allocator = Allocator()) ->
+    Except<decltype(std::begin(iterable)), decltype(std::begin(toExcept)), Allocator> {
+        return exceptrange(std::begin(iterable), std::end(iterable), std::begin(toExcept), std::end(toExcept), allocator);
     }
 
     // End of group
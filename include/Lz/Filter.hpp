@@ -8,11 +8,17 @@
 
 #include "detail/BasicIteratorView.hpp"
 #include "detail/FilterIterator.hpp"
+#include "detail/Pipe.hpp"
 
 
 namespace lz {
+    namespace detail {
+        template<class Function>
+        class FilterAdaptor;
+    }
+
     template<class Iterator, class Function>
-    class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Iterator, Function>> {
+    class Filter final : public detail::BasicIteratorView<Filter<Iterator, Function>, detail::FilterIterator<Iterator, Function>> {
     public:
         using iterator = detail::FilterIterator<Iterator, Function>;
         using const_iterator = iterator;
@@ -20,7 +26,7 @@ namespace lz {
         using value_type = typename iterator::value_type;
 
     private:
-        std::function<bool(value_type)> _predicate{};
+        detail::FunctionContainer<Function> _predicate{};
         Iterator _begin{};
         Iterator _end{};
 
@@ -32,7 +38,7 @@ namespace lz {
          * @param function A function with parameter the value type of the iterable and must return a bool.
          */
         Filter(const Iterator begin, const Iterator end, const Function& function) :
-            _predicate{function},
+            _predicate(function),
             _begin(begin),
             _end(end) {
         }
@@ -43,16 +49,38 @@ namespace lz {
         * @brief Returns the beginning of the filter iterator object.
         * @return A forward iterator FilterIterator.
         */
-        iterator begin() const override {
-            return iterator(_begin, _end, &_predicate);
+        iterator begin() const {
+            return iterator(_begin, _end, _predicate);
         }
 
         /**
         * @brief Returns the ending of the filter iterator object.
         * @return A forward iterator FilterIterator.
         */
-        iterator end() const override {
-            return iterator(_end, _end, &_predicate);;
+        iterator end() const {
+            return iterator(_end, _end, _predicate);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, the length of the sequence that is filtered.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
+        }
+
+        /**
+         * @brief Fuses `filter | lz::filter(predicate)` into one Filter that checks both predicates, instead of a Filter
+         * that searches through the iterators of `filter`.
+         * @param filter The filter to filter again.
+         * @param adaptor The adaptor returned by `lz::filter(predicate)`.
+         * @return A Filter over the same sequence as `filter`.
+         */
+        template<class Second>
+        friend Filter<Iterator, detail::ConjoinedPredicate<Function, Second>>
+        operator|(const Filter& filter, const detail::FilterAdaptor<Second>& adaptor) {
+            using Conjoined = detail::ConjoinedPredicate<Function, Second>;
+            return Filter<Iterator, Conjoined>(filter._begin, filter._end, Conjoined(filter._predicate.function(), adaptor.predicate()));
         }
     };
 
@@ -96,8 +124,46 @@ namespace lz {
         return filterrange(std::begin(iterable), std::end(iterable), predicate);
     }
 
+    /**
+     * @brief Returns an adaptor to filter an iterable with, e.g. `vector | lz::filter(predicate)`, which is the same as
+     * `lz::filter(vector, predicate)`. Two filter stages after each other, such as `vector | lz::filter(p) | lz::filter(q)`,
+     * are fused into one Filter that checks `p(value) && q(value)`.
+     * @tparam Function Is automatically deduced, but must be a function, lambda or functor.
+     * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
+     * @return An adaptor that can be used on the right hand side of `|`.
+     */
+    template<class Function>
+    detail::FilterAdaptor<Function> filter(const Function& predicate) {
+        return detail::FilterAdaptor<Function>(predicate);
+    }
+
     // End of group
     /**
      * @}
      */
+
+    namespace detail {
+        template<class Function>
+        class FilterAdaptor : public PipeAdaptor {
+            std::decay_t<Function> _predicate;
+
+        public:
+            explicit FilterAdaptor(const Function& predicate) :
+                _predicate(predicate) {
+            }
+
+            const std::decay_t<Function>& predicate() const {
+                return _predicate;
+            }
+
+            template<class Iterable>
+            auto operator()(Iterable&& iterable) const -> decltype(lz::filter(std::forward<Iterable>(iterable), _predicate)) {
+                return lz::filter(std::forward<Iterable>(iterable), _predicate);
+            }
+        };
+
+        template<class Iterator, class First, class Second>
+        struct IsFusable<Filter<Iterator, First>, FilterAdaptor<Second>> : std::true_type {
+        };
+    }
 }
\ No newline at end of file
@@ -6,28 +6,160 @@
 
 #include "StringSplitter.hpp"
 #include "Join.hpp"
+#include "detail/ClosedForm.hpp"
+#include "detail/Parallel.hpp"
 
 
 namespace lz {
     namespace detail {
+        template<class Container>
+        struct IterTupleCreator {
+
+        };
+
+        template<class Iterator, class Init, class SelectorFunc, class BinaryOp>
+        Init transfoldSegments(const Iterator begin, const Iterator end, Init init, const SelectorFunc& selectorFunc,
+                               const BinaryOp& binaryOp) {
+            // One loop per segment, so that the elements of a concatenation are read through the iterators of its sequences
+            auto foldSegment = [&init, &selectorFunc, &binaryOp](auto first, const auto last) {
+                for (; first != last; ++first) {
+                    init = binaryOp(std::move(init), selectorFunc(*first));
+                }
+            };
+            visitSegments(begin, end, foldSegment);
+            return init;
+        }
+
+        template<class Iterator, class Init, class SelectorFunc, class BinaryOp>
+        Init transfold(const ParallelPolicy /*policy*/, const Iterator begin, const Iterator end, Init init,
+                       const SelectorFunc selectorFunc, const BinaryOp binaryOp, std::false_type /*isRandomAccess*/) {
+            return transfoldSegments(begin, end, std::move(init), selectorFunc, binaryOp);
+        }
+
+        template<class Iterator, class Init, class SelectorFunc, class BinaryOp>
+        Init transfold(const ParallelPolicy policy, const Iterator begin, const Iterator end, Init init,
+                       const SelectorFunc selectorFunc, const BinaryOp binaryOp, std::true_type /*isRandomAccess*/) {
+            const DifferenceType<Iterator> distance = std::distance(begin, end);
+            if (distance <= 0) {
+                return init;
+            }
+
+            // Every chunk starts with its first element, so that no identity value for binaryOp is needed
+            std::vector<Init> partials = parallelChunks(policy, static_cast<std::size_t>(distance),
+                                                        [begin, &selectorFunc, &binaryOp](const std::size_t from, const std::size_t to) {
+                Iterator current = std::next(begin, static_cast<DifferenceType<Iterator>>(from));
+                const Iterator chunkEnd = std::next(begin, static_cast<DifferenceType<Iterator>>(to));
+
+                Init partial = static_cast<Init>(selectorFunc(*current));
+                for (++current; current != chunkEnd; ++current) {
+                    partial = binaryOp(std::move(partial), selectorFunc(*current));
+                }
+                return partial;
+            });
+
+            for (Init& partial : partials) {
+                init = binaryOp(std::move(init), std::move(partial));
+            }
+            return init;
+        }
+
         template<class Iterator>
-        using ValueType = typename std::iterator_traits<Iterator>::value_type;
+        ValueType<Iterator> sumOf(const ParallelPolicy /*policy*/, const Iterator begin, const Iterator end,
+                                  std::true_type /*hasStridedSum*/) {
+            return sumOf(begin, end, std::true_type());
+        }
 
         template<class Iterator>
-        using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+        ValueType<Iterator> sumOf(const ParallelPolicy policy, const Iterator begin, const Iterator end,
+                                  std::false_type /*hasStridedSum*/) {
+            using T = ValueType<Iterator>;
+            return transfold(policy, begin, end, T(0), [](const T& value) { return value; }, std::plus<T>(),
+                             IsRandomAccess<Iterator>());
+        }
+    }
 
-        template<class Iterable>
-        using ValueTypeIterable = typename std::iterator_traits<decltype(std::begin(std::declval<Iterable>()))>::value_type;
+    /**
+     * Passes the elements of a sequence in chunks, by calling `sink(const value_type* data, std::size_t count)` until all
+     * elements have been passed. Contiguous containers such as `std::vector` are passed in one chunk. See also
+     * `forEachChunk` of the views.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Sink Is automatically deduced.
+     * @param iterable The sequence, which must be finite.
+     * @param sink The function that receives the chunks. The pointer is only valid during the call.
+     */
+    template<class Iterable, class Sink>
+    void forEachChunk(const Iterable& iterable, Sink sink) {
+        detail::visitChunks(std::begin(iterable), std::end(iterable), sink);
+    }
 
+    /**
+     * Calls `function(first, last)` for consecutive ranges that together form the sequence. For most sequences this is one
+     * call with `std::begin(iterable)` and `std::end(iterable)`, but the result of `lz::concat` is passed per concatenated
+     * sequence, with the iterators of that sequence. This way, a loop over the elements does not have to go through the
+     * iterator of `lz::concat` for every element. Nested concatenations are flattened.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Function Is automatically deduced.
+     * @param iterable The sequence.
+     * @param function A generic function that receives the beginning and the ending of every range.
+     */
+    template<class Iterable, class Function>
+    void forEachSegment(const Iterable& iterable, Function function) {
+        detail::visitSegments(std::begin(iterable), std::end(iterable), function);
+    }
 
-        template<class Container>
-        struct IterTupleCreator {
+    /**
+     * Gets the sum of a sequence. The sum of `lz::range` and of `lz::repeat` of a number, also through `lz::take`,
+     * `lz::slice` and `lz::takeevery`, is computed in constant time with a formula instead of a loop. For floating point
+     * numbers, the result of the formula may differ in its last digits from adding the elements one by one.
+     * @tparam Iterator Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @return The sum of the sequence.
+     */
+    template<class Iterator>
+    detail::ValueType<Iterator> sum(const Iterator begin, const Iterator end) {
+        return detail::sumOf(begin, end);
+    }
 
-        };
+    /**
+     * Gets the sum of a sequence, see `sum(begin, end)`.
+     * @tparam Iterable Is automatically deduced.
+     * @param container The container to calculate the sum of.
+     * @return The sum of the container.
+     */
+    template<class Iterable>
+    detail::ValueTypeIterable<const Iterable&> sum(const Iterable& container) {
+        return sum(std::begin(container), std::end(container));
     }
 
     /**
-     * Gets the mean of a sequence.
+     * Gets the sum of a sequence, using multiple threads if the sequence is random access and has no formula for its sum,
+     * see `sum(begin, end)`.
+     * @tparam Iterator Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @return The sum of the sequence.
+     */
+    template<class Iterator>
+    detail::ValueType<Iterator> sum(const ParallelPolicy policy, const Iterator begin, const Iterator end) {
+        return detail::sumOf(policy, begin, end, detail::HasStridedSum<Iterator>());
+    }
+
+    /**
+     * Gets the sum of a sequence, using multiple threads if the sequence is random access and has no formula for its sum.
+     * @tparam Iterable Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param container The container to calculate the sum of.
+     * @return The sum of the container.
+     */
+    template<class Iterable>
+    detail::ValueTypeIterable<const Iterable&> sum(const ParallelPolicy policy, const Iterable& container) {
+        return sum(policy, std::begin(container), std::end(container));
+    }
+
+    /**
+     * Gets the mean of a sequence. Like `sum`, this takes constant time for `lz::range` and `lz::repeat`.
      * @tparam Iterator Is automatically deduced.
      * @param begin The beginning of the sequence.
      * @param end The ending of the sequence.
@@ -36,8 +168,7 @@ namespace lz {
     template<class Iterator>
     double mean(const Iterator begin, const Iterator end) {
         const detail::DifferenceType<Iterator> distance = std::distance(begin, end);
-        const detail::ValueType<Iterator> sum = std::accumulate(begin, end, detail::ValueType<Iterator>(0));
-        return static_cast<double>(sum) / distance;
+        return static_cast<double>(sum(begin, end)) / distance;
     }
 
     /**
@@ -51,6 +182,33 @@ namespace lz {
         return mean(std::begin(container), std::end(container));
     }
 
+    /**
+     * Gets the mean of a sequence, using multiple threads if the sequence is random access. Every thread sums up its own
+     * chunk of the sequence, after which the partial sums are added together.
+     * @tparam Iterator Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @return The mean of the sequence.
+     */
+    template<class Iterator>
+    double mean(const ParallelPolicy policy, const Iterator begin, const Iterator end) {
+        const detail::DifferenceType<Iterator> distance = std::distance(begin, end);
+        return static_cast<double>(sum(policy, begin, end)) / distance;
+    }
+
+    /**
+     * Gets the mean of a sequence, using multiple threads if the sequence is random access.
+     * @tparam Iterable Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param container The container to calculate the mean of.
+     * @return The mean of the container.
+     */
+    template<class Iterable>
+    double mean(const ParallelPolicy policy, const Iterable& container) {
+        return mean(policy, std::begin(container), std::end(container));
+    }
+
     /**
      * Gets the median of a sequence.
      * @tparam Iterator Is automatically deduced.
@@ -140,29 +298,28 @@ namespace lz {
 
     /**
      * Returns a StringSplitter iterator, that splits the string on `'\n'`.
-     * @tparam SubString The string type that the `StringSplitter::value_type` must return. Must either be std::string or std::string_view.
-     * @tparam String The string type. `std::string` is assumed but can be specified.
+     * @tparam SubString The string type that the `StringSplitter::value_type` must return. `lz::StringView` by default, which
+     * does not copy the lines. Can be std::string.
+     * @tparam String The string type. Is automatically deduced.
      * @param string The string to split on.
      * @return Returns a StringSplitter iterator, that splits the string on `'\n'`.
      */
-    template<class SubString = std::string, class String = std::string>
+    template<class SubString = StringView, class String = StringView>
     StringSplitter<SubString, String> lines(String&& string) {
         return split<SubString, String>(string, "\n");
     }
 
     /**
-     * The exact opposite of `lines`. It joins a container of `std::string` or `std::string_view` container with `'\n'` as delimiter.
-     * @tparam Strings Is automatically deduced, but must be a container of `std::string` or `std::string_view`
-     * @param strings The container of `std::string` or `std::string_view`.
+     * The exact opposite of `lines`. It joins a container of `std::string` or `lz::StringView` container with `'\n'` as delimiter.
+     * @tparam Strings Is automatically deduced, but must be a container of `std::string` or `lz::StringView`
+     * @param strings The container of `std::string` or `lz::StringView`.
      * @return A Join iterator that joins the strings in the container on `'\n'`.
      */
     template<class Strings>
     auto unlines(Strings&& strings) -> Join<std::decay_t<decltype(std::begin(strings))>> {
-        static_assert(std::is_same<std::string, typename std::decay_t<Strings>::value_type>::value
-                      #ifndef CXX_LT_17
-                      || std::is_same<std::string_view, typename std::decay_t<Strings>::value_type>::value
-#endif
-            , "the type of the container should be std::string or std::string_view");
+        static_assert(std::is_same<std::string, typename std::decay_t<Strings>::value_type>::value ||
+                      std::is_same<StringView, typename std::decay_t<Strings>::value_type>::value,
+                      "the type of the container should be std::string or lz::StringView");
         return join(strings, "\n");
     }
 
@@ -187,11 +344,8 @@ namespace lz {
      * @return The result of the transfold operation.
      */
     template<class Iterator, class Init, class SelectorFunc, class BinaryOp>
-    Init transfold(Iterator begin, const Iterator end, Init init, const SelectorFunc selectorFunc, const BinaryOp binaryOp) {
-        for (; begin != end; ++begin) {
-            init = binaryOp(std::move(init), selectorFunc(*begin));
-        }
-        return init;
+    Init transfold(const Iterator begin, const Iterator end, Init init, const SelectorFunc selectorFunc, const BinaryOp binaryOp) {
+        return detail::transfoldSegments(begin, end, std::move(init), selectorFunc, binaryOp);
     }
 
     /**
@@ -263,4 +417,79 @@ namespace lz {
     Init transaccumulate(const Iterable& it, Init init, const SelectorFunc selectorFunc, const BinaryOp binaryOp) {
         return transfold(std::begin(it), std::end(it), init, selectorFunc, binaryOp);
     }
+
+    /**
+     * Performs `transfold` using multiple threads if the sequence is random access. The sequence is split into chunks, every
+     * chunk is folded on its own thread, after which the partial results are combined with `binaryOp`. Therefore `binaryOp`
+     * must be associative and must also accept two `Init` values, like `std::plus<>` does.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam SelectorFunc Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param begin The beginning of the sequence
+     * @param end The ending of the sequence
+     * @param init The starting value.
+     * @param selectorFunc Function that specifies what to add to `init`. Must be thread safe.
+     * @param binaryOp An associative binary operation for e.g. `std::plus<[TYPE]>()`.
+     * @return The result of the transfold operation.
+     */
+    template<class Iterator, class Init, class SelectorFunc, class BinaryOp>
+    Init transfold(const ParallelPolicy policy, const Iterator begin, const Iterator end, Init init, const SelectorFunc selectorFunc,
+                   const BinaryOp binaryOp) {
+        return detail::transfold(policy, begin, end, std::move(init), selectorFunc, binaryOp, detail::IsRandomAccess<Iterator>());
+    }
+
+    /**
+     * Performs `transaccumulate` using multiple threads if the sequence is random access.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam SelectorFunc Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param begin The beginning of the sequence
+     * @param end The ending of the sequence
+     * @param init The starting value.
+     * @param selectorFunc Function that specifies what to add to `init`. Must be thread safe.
+     * @return The result of the transfold operation.
+     */
+    template<class Iterator, class Init, class SelectorFunc>
+    Init transaccumulate(const ParallelPolicy policy, const Iterator begin, const Iterator end, Init init, const SelectorFunc selectorFunc) {
+        return transfold(policy, begin, end, std::move(init), selectorFunc, std::plus<Init>());
+    }
+
+    /**
+     * Performs `transaccumulate` using multiple threads if the sequence is random access.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam SelectorFunc Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param it The container to iterate over.
+     * @param init The starting value.
+     * @param selectorFunc Function that specifies what to add to `init`. Must be thread safe.
+     * @return The result of the transfold operation.
+     */
+    template<class Iterable, class Init, class SelectorFunc>
+    Init transaccumulate(const ParallelPolicy policy, const Iterable& it, Init init, const SelectorFunc selectorFunc) {
+        return transfold(policy, std::begin(it), std::end(it), std::move(init), selectorFunc, std::plus<Init>());
+    }
+
+    /**
+     * Performs `transaccumulate` using multiple threads if the sequence is random access. `binaryOp` must be associative
+     * and must also accept two `Init` values, like `std::plus<>` does.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam SelectorFunc  Is automatically deduced.
+     * @tparam BinaryOp Is automatically deduced.
+     * @param policy The parallel execution policy, for e.g. `lz::par`.
+     * @param it The container to iterate over.
+     * @param init The starting value.
+     * @param selectorFunc Function that specifies what to add to `init`. Must be thread safe.
+     * @param binaryOp An associative binary operation for e.g. `std::plus<[TYPE]>()`.
+     * @return The result of the transfold operation.
+     */
+    template<class Iterable, class Init, class SelectorFunc, class BinaryOp>
+    Init transaccumulate(const ParallelPolicy policy, const Iterable& it, Init init, const SelectorFunc selectorFunc,
+                         const BinaryOp binaryOp) {
+        return transfold(policy, std::begin(it), std::end(it), std::move(init), selectorFunc, binaryOp);
+    }
 }
\ No newline at end of file
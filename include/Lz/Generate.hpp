@@ -8,7 +8,7 @@
 
 namespace lz {
     template<class GeneratorFunc>
-    class Generate final : public detail::BasicIteratorView<detail::GenerateIterator<GeneratorFunc>> {
+    class Generate final : public detail::BasicIteratorView<Generate<GeneratorFunc>, detail::GenerateIterator<GeneratorFunc>> {
     public:
         using iterator = detail::GenerateIterator<GeneratorFunc>;
         using const_iterator = iterator;
@@ -16,7 +16,7 @@ namespace lz {
 
     private:
         size_t _amount{};
-        detail::GenerateIteratorHelper<GeneratorFunc, value_type> _helper;
+        detail::GenerateIteratorHelper<GeneratorFunc> _helper;
 
     public:
         /**
@@ -29,7 +29,7 @@ namespace lz {
          */
         Generate(const GeneratorFunc& func, const size_t amount):
             _amount(amount),
-            _helper{func, amount == std::numeric_limits<size_t>::max()}
+            _helper{detail::FunctionContainer<GeneratorFunc>(func), amount == std::numeric_limits<size_t>::max()}
         {
         }
 
@@ -39,7 +39,7 @@ namespace lz {
         * @brief Returns the beginning of the map iterator object.
         * @return A bidirectional iterator MapIterator.
         */
-        iterator begin() const override {
+        iterator begin() const {
             return iterator(0, &_helper);
         }
 
@@ -47,9 +47,20 @@ namespace lz {
         * @brief Returns the ending of the map iterator object.
         * @return A bidirectional iterator MapIterator.
         */
-        iterator end() const override {
+        iterator end() const {
             return iterator(_amount, &_helper);
         }
+
+        /**
+         * @brief Returns the amount of elements that are generated, or unknown if it is a `while-true` loop.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            if (_amount == std::numeric_limits<size_t>::max()) {
+                return detail::SizeHint::unknown();
+            }
+            return detail::SizeHint::exact(_amount);
+        }
     };
 
     /**
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <vector>
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/FlatHashMap.hpp"
+#include "detail/ForEachSegment.hpp"
+#include "detail/GroupByIterator.hpp"
+
+
+namespace lz {
+    namespace detail {
+        template<class Iterator, class KeySelector>
+        using GroupKey = std::decay_t<FunctionReturnType<KeySelector, typename std::iterator_traits<Iterator>::reference>>;
+
+        // Short sequences get all their memory at once, long ones may contain far fewer keys than elements
+        constexpr std::size_t MaxInitialGroupReserve = 1024;
+
+        /**
+         * Passes every element once to `update(accumulatorOfItsKey, element)`. The accumulator of a key is created from
+         * `init` the first time the key occurs.
+         */
+        template<class Map, class Iterator, class KeySelector, class Init, class UpdateFunction>
+        void aggregateInto(Map& map, const Iterator begin, const Iterator end, const KeySelector& keySelector, const Init& init,
+                           const UpdateFunction& update) {
+            const SizeHint hint = sizeHintOf(begin, end);
+            if (hint.isKnown()) {
+                map.reserve(hint.size < MaxInitialGroupReserve ? hint.size : MaxInitialGroupReserve);
+            }
+
+            auto aggregateSegment = [&map, &keySelector, &init, &update](auto first, const auto last) {
+                for (; first != last; ++first) {
+                    auto&& value = *first;
+                    update(map.tryEmplace(keySelector(value), init).first->second, value);
+                }
+            };
+            visitSegments(begin, end, aggregateSegment);
+        }
+    }
+
+    template<class Iterator, class KeySelector>
+    class GroupBy final : public detail::BasicIteratorView<GroupBy<Iterator, KeySelector>,
+                                                           detail::GroupByIterator<Iterator, KeySelector>> {
+    public:
+        using iterator = detail::GroupByIterator<Iterator, KeySelector>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        detail::FunctionContainer<KeySelector> _keySelector{};
+        Iterator _begin{};
+        Iterator _end{};
+
+    public:
+        /**
+         * @brief Creates a GroupBy view object, which yields every run of consecutive elements with the same key.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param keySelector A function that takes a value type as parameter and returns its key. Keys are compared with
+         * `operator==`.
+         */
+        GroupBy(const Iterator begin, const Iterator end, const KeySelector& keySelector) :
+            _keySelector(keySelector),
+            _begin(begin),
+            _end(end) {
+        }
+
+        GroupBy() = default;
+
+        /**
+         * @brief Returns the beginning of the sequence.
+         * @return The beginning of the sequence.
+         */
+        iterator begin() const {
+            return iterator(_begin, _end, _keySelector);
+        }
+
+        /**
+         * @brief Returns the ending of the sequence.
+         * @return The ending of the sequence.
+         */
+        iterator end() const {
+            return iterator(_end, _end, _keySelector);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of groups, the length of the sequence.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
+        }
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns a GroupBy view object, for sequences that are sorted by key.
+     * @details Every group is a `std::pair<Key, lz::Take<Iterator>>` of a key and the consecutive elements with that key,
+     * which are not copied. Groups are found while iterating, so the view uses O(1) memory. Elements with the same key
+     * that are not next to each other end up in different groups, use `lz::groupBy` for sequences that are not sorted.
+     * Requires forward iterators.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @return A GroupBy view object, which can be used to iterate over in a `(for ... : groupBySortedRange(...))` fashion.
+     */
+    template<class Iterator, class KeySelector>
+    GroupBy<Iterator, KeySelector> groupBySortedRange(const Iterator begin, const Iterator end, const KeySelector& keySelector) {
+        return GroupBy<Iterator, KeySelector>(begin, end, keySelector);
+    }
+
+    /**
+     * @brief Returns a GroupBy view object, for sequences that are sorted by key.
+     * @details Every group is a `std::pair<Key, lz::Take<Iterator>>` of a key and the consecutive elements with that key,
+     * which are not copied. Groups are found while iterating, so the view uses O(1) memory. Elements with the same key
+     * that are not next to each other end up in different groups, use `lz::groupBy` for sequences that are not sorted.
+     * Requires forward iterators.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @param iterable The iterable sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @return A GroupBy view object, which can be used to iterate over in a `(for ... : groupBySorted(...))` fashion.
+     */
+    template<class Iterable, class KeySelector>
+    auto groupBySorted(Iterable&& iterable, const KeySelector& keySelector) -> GroupBy<decltype(std::begin(iterable)), KeySelector> {
+        return groupBySortedRange(std::begin(iterable), std::end(iterable), keySelector);
+    }
+
+    /**
+     * @brief Groups the elements of a sequence by key, in one pass.
+     * @details The elements are copied into a `std::vector` per key, in the order in which they occur. The groups are
+     * stored in an `lz::FlatHashMap`, in the order in which their keys first occur. Use `lz::aggregateBy` if the elements
+     * themselves are not needed, e.g. to count them or to sum them per key.
+     * @tparam Iterator Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @param hash The hash function of the keys, `std::hash` by default.
+     * @param keyEqual The function that checks whether two keys are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the map.
+     * @return An `lz::FlatHashMap<Key, std::vector<value_type>>`.
+     */
+    template<class Iterator, class KeySelector, class Key = detail::GroupKey<Iterator, KeySelector>,
+        class Group = std::vector<detail::ValueType<Iterator>>, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+        class Allocator = std::allocator<std::pair<const Key, Group>>>
+    FlatHashMap<Key, Group, Hash, KeyEqual, Allocator>
+    groupByRange(const Iterator begin, const Iterator end, const KeySelector& keySelector, Hash hash = Hash(),
+                 KeyEqual keyEqual = KeyEqual(), const Allocator& allocator = Allocator()) {
+        FlatHashMap<Key, Group, Hash, KeyEqual, Allocator> groups(std::move(hash), std::move(keyEqual), allocator);
+        detail::aggregateInto(groups, begin, end, keySelector, Group(), [](Group& group, const detail::ValueType<Iterator>& value) {
+            group.push_back(value);
+        });
+        return groups;
+    }
+
+    /**
+     * @brief Groups the elements of a sequence by key, in one pass.
+     * @details The elements are copied into a `std::vector` per key, in the order in which they occur. The groups are
+     * stored in an `lz::FlatHashMap`, in the order in which their keys first occur. Use `lz::aggregateBy` if the elements
+     * themselves are not needed, e.g. to count them or to sum them per key.
+     * @tparam Iterable Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @param iterable The iterable sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @param hash The hash function of the keys, `std::hash` by default.
+     * @param keyEqual The function that checks whether two keys are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the map.
+     * @return An `lz::FlatHashMap<Key, std::vector<value_type>>`.
+     */
+    template<class Iterable, class KeySelector, class Iterator = decltype(std::begin(std::declval<Iterable&>())),
+        class Key = detail::GroupKey<Iterator, KeySelector>, class Group = std::vector<detail::ValueType<Iterator>>,
+        class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<std::pair<const Key, Group>>>
+    FlatHashMap<Key, Group, Hash, KeyEqual, Allocator>
+    groupBy(Iterable&& iterable, const KeySelector& keySelector, Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(),
+            const Allocator& allocator = Allocator()) {
+        return groupByRange(std::begin(iterable), std::end(iterable), keySelector, std::move(hash), std::move(keyEqual),
+                            allocator);
+    }
+
+    /**
+     * @brief Folds the elements of a sequence per key, in one pass and without storing the elements.
+     * @details For every element, the value of its key becomes `foldFunction(value, element)`, where the value of a new
+     * key starts as `init`. For example, to count the words per first letter:
+     * ```cpp
+     * lz::FlatHashMap<char, int> counts = lz::aggregateBy(words, [](const std::string& s) { return s[0]; }, 0,
+     *     [](int count, const std::string&) { return count + 1; });
+     * ```
+     * @tparam Iterator Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam FoldFunction Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @param init The value of a key before its first element is folded.
+     * @param foldFunction A function that takes the value of a key and an element, and returns the new value of the key.
+     * @param hash The hash function of the keys, `std::hash` by default.
+     * @param keyEqual The function that checks whether two keys are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the map.
+     * @return An `lz::FlatHashMap<Key, Init>`, in the order in which the keys first occur.
+     */
+    template<class Iterator, class KeySelector, class Init, class FoldFunction, class Key = detail::GroupKey<Iterator, KeySelector>,
+        class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<std::pair<const Key, Init>>>
+    FlatHashMap<Key, Init, Hash, KeyEqual, Allocator>
+    aggregateByRange(const Iterator begin, const Iterator end, const KeySelector& keySelector, const Init& init,
+                     const FoldFunction& foldFunction, Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(),
+                     const Allocator& allocator = Allocator()) {
+        FlatHashMap<Key, Init, Hash, KeyEqual, Allocator> aggregates(std::move(hash), std::move(keyEqual), allocator);
+        detail::aggregateInto(aggregates, begin, end, keySelector, init, [&foldFunction](Init& aggregate, const auto& value) {
+            aggregate = foldFunction(std::move(aggregate), value);
+        });
+        return aggregates;
+    }
+
+    /**
+     * @brief Folds the elements of a sequence per key, in one pass and without storing the elements.
+     * @details For every element, the value of its key becomes `foldFunction(value, element)`, where the value of a new
+     * key starts as `init`. For example, to count the words per first letter:
+     * ```cpp
+     * lz::FlatHashMap<char, int> counts = lz::aggregateBy(words, [](const std::string& s) { return s[0]; }, 0,
+     *     [](int count, const std::string&) { return count + 1; });
+     * ```
+     * @tparam Iterable Is automatically deduced.
+     * @tparam KeySelector Is automatically deduced.
+     * @tparam Init Is automatically deduced.
+     * @tparam FoldFunction Is automatically deduced.
+     * @param iterable The iterable sequence.
+     * @param keySelector A function that takes a value type as parameter and returns its key.
+     * @param init The value of a key before its first element is folded.
+     * @param foldFunction A function that takes the value of a key and an element, and returns the new value of the key.
+     * @param hash The hash function of the keys, `std::hash` by default.
+     * @param keyEqual The function that checks whether two keys are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the map.
+     * @return An `lz::FlatHashMap<Key, Init>`, in the order in which the keys first occur.
+     */
+    template<class Iterable, class KeySelector, class Init, class FoldFunction,
+        class Iterator = decltype(std::begin(std::declval<Iterable&>())), class Key = detail::GroupKey<Iterator, KeySelector>,
+        class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<std::pair<const Key, Init>>>
+    FlatHashMap<Key, Init, Hash, KeyEqual, Allocator>
+    aggregateBy(Iterable&& iterable, const KeySelector& keySelector, const Init& init, const FoldFunction& foldFunction,
+                Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(), const Allocator& allocator = Allocator()) {
+        return aggregateByRange(std::begin(iterable), std::end(iterable), keySelector, init, foldFunction, std::move(hash),
+                                std::move(keyEqual), allocator);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
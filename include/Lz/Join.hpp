@@ -1,12 +1,14 @@
 #pragma once
 
+#include <algorithm>
+
 #include "detail/JoinIterator.hpp"
 #include "detail/BasicIteratorView.hpp"
 
 
  namespace lz {
      template<class Iterator>
-class Join : public detail::BasicIteratorView<detail::JoinIterator<Iterator>>{
+class Join : public detail::BasicIteratorView<Join<Iterator>, detail::JoinIterator<Iterator>>{
      public:
          using iterator = detail::JoinIterator<Iterator>;
          using const_iterator = iterator;
@@ -52,6 +54,14 @@ class Join : public detail::BasicIteratorView<detail::JoinIterator<Iterator>>{
          iterator end() const {
              return iterator(_end, _delimiter, false, _distance);
          }
+
+         /**
+          * @brief Returns the exact amount of values and delimiters.
+          * @return The size hint of this view.
+          */
+         detail::SizeHint sizeHint() const {
+             return detail::SizeHint::exact(_distance > 0 ? static_cast<size_t>(_distance) : 0);
+         }
      };
 
      /**
@@ -88,6 +98,59 @@ class Join : public detail::BasicIteratorView<detail::JoinIterator<Iterator>>{
          return joinrange(std::begin(iterable), std::end(iterable), std::move(delimiter));
      }
 
+     /**
+      * @brief Writes the values of `iterable` to `out`, separated by `delimiter`, e.g. `"1, 2, 3"`.
+      * @details Unlike `lz::join`, no `std::string` is created per value or delimiter: integers are formatted with
+      * `fmt::format_int` and all other values are formatted on the stack before they are appended.
+      * @tparam Iterable Is automatically deduced.
+      * @param iterable The iterable to join with the delimiter.
+      * @param out The string to append the text to.
+      * @param delimiter The delimiter to separate the previous and the next values in the sequence.
+      */
+     template<class Iterable, class Traits, class Allocator>
+     void joinTo(const Iterable& iterable, std::basic_string<char, Traits, Allocator>& out, const fmt::string_view delimiter) {
+         detail::ChunkedAppender<std::basic_string<char, Traits, Allocator>> append(out);
+         detail::joinInto(std::begin(iterable), std::end(iterable), append, delimiter);
+         append.flush();
+     }
+
+     /**
+      * @brief Writes the values of `iterable` to `out`, separated by `delimiter`, e.g. `"1, 2, 3"`.
+      * @details Unlike `lz::join`, no `std::string` is created per value or delimiter: integers are formatted with
+      * `fmt::format_int` and all other values are formatted on the stack before they are appended.
+      * @tparam Iterable Is automatically deduced.
+      * @param iterable The iterable to join with the delimiter.
+      * @param out The buffer to append the text to, e.g. a `fmt::memory_buffer`.
+      * @param delimiter The delimiter to separate the previous and the next values in the sequence.
+      */
+     template<class Iterable, std::size_t Size, class Allocator>
+     void joinTo(const Iterable& iterable, fmt::basic_memory_buffer<char, Size, Allocator>& out, const fmt::string_view delimiter) {
+         auto append = [&out](const char* data, const std::size_t size) {
+             out.append(data, data + size);
+         };
+         detail::joinInto(std::begin(iterable), std::end(iterable), append, delimiter);
+     }
+
+     /**
+      * @brief Writes the values of `iterable` to the output iterator `out`, separated by `delimiter`, e.g. `"1, 2, 3"`.
+      * @details Unlike `lz::join`, no `std::string` is created per value or delimiter: integers are formatted with
+      * `fmt::format_int` and all other values are formatted on the stack before they are written.
+      * @tparam Iterable Is automatically deduced.
+      * @tparam OutputIterator Is automatically deduced.
+      * @param iterable The iterable to join with the delimiter.
+      * @param out An output iterator of `char`, e.g. a `std::ostreambuf_iterator<char>`.
+      * @param delimiter The delimiter to separate the previous and the next values in the sequence.
+      * @return The output iterator after the last written character.
+      */
+     template<class Iterable, class OutputIterator>
+     OutputIterator joinTo(const Iterable& iterable, OutputIterator out, const fmt::string_view delimiter) {
+         auto append = [&out](const char* data, const std::size_t size) {
+             out = std::copy(data, data + size, out);
+         };
+         detail::joinInto(std::begin(iterable), std::end(iterable), append, delimiter);
+         return out;
+     }
+
      // End of group
      /**
       * @}
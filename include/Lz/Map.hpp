@@ -2,6 +2,7 @@
 
 #include "detail/BasicIteratorView.hpp"
 #include "detail/MapIterator.hpp"
+#include "detail/Pipe.hpp"
 
 #include <vector>
 #include <array>
@@ -9,18 +10,20 @@
 
 
 namespace lz {
+    namespace detail {
+        template<class Function>
+        class MapAdaptor;
+    }
+
     template<class Iterator, class Function>
-    class Map final : public detail::BasicIteratorView<detail::MapIterator<Iterator, Function>> {
+    class Map final : public detail::BasicIteratorView<Map<Iterator, Function>, detail::MapIterator<Iterator, Function>> {
     public:
         using iterator = detail::MapIterator<Iterator, Function>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
     private:
-        using FnParamType = typename detail::MapIterator<Iterator, Function>::FnParamType;
-        using FnReturnType = typename detail::MapIterator<Iterator, Function>::FnReturnType;
-
-        std::function<FnReturnType(FnParamType)> _function{};
+        detail::FunctionContainer<Function> _function{};
         Iterator _begin{};
         Iterator _end{};
 
@@ -43,16 +46,30 @@ namespace lz {
         * @brief Returns the beginning of the map iterator object.
         * @return A bidirectional iterator MapIterator.
         */
-        iterator begin() const override {
-            return iterator(_begin, &_function);
+        iterator begin() const {
+            return iterator(_begin, _function);
         }
 
         /**
         * @brief Returns the ending of the map iterator object.
         * @return A bidirectional iterator MapIterator.
         */
-        iterator end() const override {
-            return iterator(_end, &_function);
+        iterator end() const {
+            return iterator(_end, _function);
+        }
+
+        /**
+         * @brief Fuses `map | lz::map(function)` into one Map that calls `function` on the result of the function of `map`,
+         * instead of a Map that wraps the iterators of `map`.
+         * @param map The map to map again.
+         * @param adaptor The adaptor returned by `lz::map(function)`.
+         * @return A Map over the same sequence as `map`.
+         */
+        template<class Second>
+        friend Map<Iterator, detail::ComposedFunction<Function, Second>>
+        operator|(const Map& map, const detail::MapAdaptor<Second>& adaptor) {
+            using Composed = detail::ComposedFunction<Function, Second>;
+            return Map<Iterator, Composed>(map._begin, map._end, Composed(map._function.function(), adaptor.function()));
         }
     };
 
@@ -95,8 +112,46 @@ namespace lz {
         return maprange(std::begin(iterable), std::end(iterable), function);
     }
 
+    /**
+     * @brief Returns an adaptor to map an iterable with, e.g. `vector | lz::map(function)`, which is the same as
+     * `lz::map(vector, function)`. Two map stages after each other, such as `vector | lz::map(f) | lz::map(g)`, are
+     * fused into one Map that calls `g(f(value))`.
+     * @tparam Function Is automatically deduced.
+     * @param function A function that takes a value type as parameter. It may return anything.
+     * @return An adaptor that can be used on the right hand side of `|`.
+     */
+    template<class Function>
+    detail::MapAdaptor<Function> map(const Function& function) {
+        return detail::MapAdaptor<Function>(function);
+    }
+
     // End of group
     /**
      * @}
      */
+
+    namespace detail {
+        template<class Function>
+        class MapAdaptor : public PipeAdaptor {
+            std::decay_t<Function> _function;
+
+        public:
+            explicit MapAdaptor(const Function& function) :
+                _function(function) {
+            }
+
+            const std::decay_t<Function>& function() const {
+                return _function;
+            }
+
+            template<class Iterable>
+            auto operator()(Iterable&& iterable) const -> decltype(lz::map(std::forward<Iterable>(iterable), _function)) {
+                return lz::map(std::forward<Iterable>(iterable), _function);
+            }
+        };
+
+        template<class Iterator, class First, class Second>
+        struct IsFusable<Map<Iterator, First>, MapAdaptor<Second>> : std::true_type {
+        };
+    }
 }
@@ -0,0 +1,250 @@
+#pragma once
+
+
+#include "StringView.hpp"
+#include "detail/BasicIteratorView.hpp"
+
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+
+namespace lz {
+    /**
+     * A read only, memory mapped file. Its contents are exposed as a contiguous range of `char`s, so it can be passed to
+     * `lz::split`, `lz::lines` or `lz::join` without copying the file into a `std::string` first. The pages are loaded by
+     * the kernel when they are accessed. The object owns the mapping and is therefore move only; views created from it
+     * must not outlive it.
+     */
+    class MappedFile final : public detail::BasicIteratorView<MappedFile, const char*> {
+    public:
+        using const_iterator = const char*;
+        using iterator = const_iterator;
+        using value_type = char;
+
+    private:
+        const char* _data{""};
+        std::size_t _size{};
+
+        void unmap() noexcept {
+            if (_size == 0) {
+                return;
+            }
+#if defined(_WIN32)
+            UnmapViewOfFile(_data);
+#else
+            munmap(const_cast<char*>(_data), _size);
+#endif
+            _data = "";
+            _size = 0;
+        }
+
+#if defined(_WIN32)
+        void map(const std::string& path) {
+            const auto fail = [&path]() {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                        "lz::mmapFile: cannot map " + path);
+            };
+
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                fail();
+            }
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize)) {
+                CloseHandle(file);
+                fail();
+            }
+            if (fileSize.QuadPart == 0) {
+                CloseHandle(file);
+                return;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (mapping == nullptr) {
+                fail();
+            }
+
+            const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (data == nullptr) {
+                fail();
+            }
+            _data = static_cast<const char*>(data);
+            _size = static_cast<std::size_t>(fileSize.QuadPart);
+        }
+#else
+        void map(const std::string& path) {
+            const auto fail = [&path]() {
+                throw std::system_error(errno, std::generic_category(), "lz::mmapFile: cannot map " + path);
+            };
+
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd == -1) {
+                fail();
+            }
+
+            struct stat status{};
+            if (fstat(fd, &status) == -1) {
+                const int error = errno;
+                close(fd);
+                errno = error;
+                fail();
+            }
+            if (status.st_size == 0) {
+                close(fd);
+                return;
+            }
+
+            const auto size = static_cast<std::size_t>(status.st_size);
+            void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            const int error = errno;
+            // The mapping keeps its own reference to the file
+            close(fd);
+            if (data == MAP_FAILED) {
+                errno = error;
+                fail();
+            }
+            // Only a hint, tokenizing reads the file front to back so the kernel may read ahead aggressively
+            madvise(data, size, MADV_SEQUENTIAL);
+
+            _data = static_cast<const char*>(data);
+            _size = size;
+        }
+#endif
+
+    public:
+        /**
+         * @brief Maps the file at `path` into memory.
+         * @param path The path of the file to map.
+         * @throws std::system_error If the file cannot be opened or mapped.
+         */
+        explicit MappedFile(const std::string& path) {
+            map(path);
+        }
+
+        MappedFile() = default;
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept :
+            _data(other._data),
+            _size(other._size) {
+            other._data = "";
+            other._size = 0;
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                unmap();
+                _data = other._data;
+                _size = other._size;
+                other._data = "";
+                other._size = 0;
+            }
+            return *this;
+        }
+
+        ~MappedFile() {
+            unmap();
+        }
+
+        /**
+         * @brief Returns a pointer to the first character of the file. The contents are not null terminated.
+         * @return A pointer to the first character of the file.
+         */
+        const char* data() const {
+            return _data;
+        }
+
+        /**
+         * @brief Returns the size of the file in bytes.
+         * @return The size of the file in bytes.
+         */
+        std::size_t size() const {
+            return _size;
+        }
+
+        /**
+         * @brief Returns the size of the file in bytes, so that the file can be used where a string is expected.
+         * @return The size of the file in bytes.
+         */
+        std::size_t length() const {
+            return _size;
+        }
+
+        const char& operator[](const std::size_t index) const {
+            return _data[index];
+        }
+
+        /**
+         * @brief Returns a pointer to the first character of the file.
+         * @return A pointer to the first character of the file.
+         */
+        const_iterator begin() const {
+            return _data;
+        }
+
+        /**
+         * @brief Returns a pointer past the last character of the file.
+         * @return A pointer past the last character of the file.
+         */
+        const_iterator end() const {
+            return _data + _size;
+        }
+
+        /**
+         * @brief Returns the contents of the file as an `lz::StringView`, which is `std::string_view` since C++17.
+         * @return The contents of the file as an `lz::StringView`.
+         */
+        StringView view() const {
+            return StringView(_data, _size);
+        }
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Maps a file into memory, so that it can be tokenized without reading it into a `std::string`. For example:
+     * ```cpp
+     * lz::MappedFile file = lz::mmapFile("server.log");
+     * for (auto&& line : lz::lines(file)) {
+     *     // ...
+     * }
+     * ```
+     * The `MappedFile` must be kept alive as long as views over it are used.
+     * @param path The path of the file to map.
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @return A `MappedFile` object whose `begin()` and `end()` return `const char*`.
+     */
+    inline MappedFile mmapFile(const std::string& path) {
+        return MappedFile(path);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
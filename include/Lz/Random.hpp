@@ -3,26 +3,33 @@
 #include <type_traits>
 #include <limits>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 
 #include "detail/RandomIterator.hpp"
 #include "detail/BasicIteratorView.hpp"
 
 
 namespace lz {
-    template<class Arithmetic, class Distribution>
-    class Random final : public detail::BasicIteratorView<detail::RandomIterator<Arithmetic, Distribution>> {
+    template<class Arithmetic, class Distribution, class Engine = Xoshiro256PlusPlus>
+    class Random final : public detail::BasicIteratorView<Random<Arithmetic, Distribution, Engine>,
+                                                          detail::RandomIterator<Arithmetic, Distribution, Engine>> {
     public:
-        using iterator = detail::RandomIterator<Arithmetic, Distribution>;
+        using iterator = detail::RandomIterator<Arithmetic, Distribution, Engine>;
         using const_iterator = iterator;
         using value_type = typename iterator::value_type;
 
     private:
         size_t _amount{};
-        Arithmetic _min{}, _max{};
+        Distribution _distribution{};
+        // The engine of a seeded view, or nullptr to use the engine of the calling thread. Its iterators share it, so that
+        // they do not depend on the lifetime of the view, e.g. when it is a temporary that is passed to `lz::map`.
+        std::shared_ptr<Engine> _engine{};
 
     public:
         /**
-         * @brief Random view object constructor, from [`min, max`].
+         * @brief Random view object constructor, from [`min, max`]. The numbers are drawn from an engine that every thread
+         * has its own copy of.
          * @param min The minimum value of the random number (included).
          * @param max The maximum value of the random number (included).
          * @param amount The amount of random numbers to generate. If `std::numeric_limits<size_t>::max()` it is
@@ -30,8 +37,23 @@ namespace lz {
          */
         Random(const Arithmetic min, const Arithmetic max, const size_t amount) :
             _amount(amount),
-            _min(min),
-            _max(max) {
+            _distribution(min, max) {
+        }
+
+        /**
+         * @brief Random view object constructor, from [`min, max`]. The numbers are drawn from an engine that is seeded with
+         * `seed`, so the same seed produces the same sequence. The engine is shared by copies of this view and by its
+         * iterators, which keep it alive. Iterating over a seeded view from multiple threads at once is a data race.
+         * @param min The minimum value of the random number (included).
+         * @param max The maximum value of the random number (included).
+         * @param amount The amount of random numbers to generate. If `std::numeric_limits<size_t>::max()` it is
+         * interpreted as a `while-true` loop.
+         * @param seed The seed of the engine.
+         */
+        Random(const Arithmetic min, const Arithmetic max, const size_t amount, const std::uint64_t seed) :
+            _amount(amount),
+            _distribution(min, max),
+            _engine(std::make_shared<Engine>(static_cast<typename Engine::result_type>(seed))) {
         }
 
         Random() = default;
@@ -40,16 +62,40 @@ namespace lz {
          * @brief Returns the beginning of the sequence.
          * @return The beginning of the sequence.
          */
-        iterator begin() const override {
-            return iterator(_min, _max, 0, _amount == std::numeric_limits<size_t>::max());
+        iterator begin() const {
+            return iterator(_distribution, _engine, 0, _amount == std::numeric_limits<size_t>::max());
         }
 
         /**
          * @brief Returns the ending of the sequence.
          * @return The ending of the sequence.
          */
-        iterator end() const override {
-            return iterator(_min, _max, _amount, _amount == std::numeric_limits<size_t>::max());
+        iterator end() const {
+            return iterator(_distribution, _engine, _amount, _amount == std::numeric_limits<size_t>::max());
+        }
+
+        /**
+         * @brief Writes `count` random numbers to `out`. With the default engine and distribution the random bits are
+         * generated a block at a time, which is a lot faster than dereferencing an iterator `count` times.
+         * @param out The beginning of the output sequence, which must have room for `count` elements.
+         * @param count The amount of random numbers to write.
+         * @return An iterator past the last written element.
+         */
+        template<class OutputIterator>
+        OutputIterator fill(OutputIterator out, const size_t count) const {
+            Distribution distribution = _distribution;
+            return detail::fillRandom(_engine ? *_engine : detail::threadLocalEngine<Engine>(), distribution, out, count);
+        }
+
+        /**
+         * @brief Returns the amount of random numbers that are generated, or unknown if it is a `while-true` loop.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            if (_amount == std::numeric_limits<size_t>::max()) {
+                return detail::SizeHint::unknown();
+            }
+            return detail::SizeHint::exact(_amount);
         }
     };
     /**
@@ -60,71 +106,46 @@ namespace lz {
     /**
      * @brief Returns a random view object that generates a sequence of random numbers, using a uniform distribution.
      * @details This random access iterator view object can be used to generate a sequence of random numbers between
-     * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence (8x) of `std::random_device` as seed.
-     * @tparam Integral Is automatically deduced. Must be arithmetic type.
+     * [`min, max`] (integers) or [`min, max`) (floating points). It uses a `thread_local` xoshiro256++ engine, seeded
+     * with `std::random_device` once per thread.
+     * @tparam Arithmetic Is automatically deduced. Must be arithmetic type.
+     * @tparam Engine The random number engine, `lz::Xoshiro256PlusPlus` by default.
      * @param min The minimum value , included.
      * @param max The maximum value, included.
      * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
      * it is interpreted as a `while-true` loop.
      * @return A random view object that generates a sequence of random numbers
      */
-    template<class Integral>
-    static auto
-    random(const Integral min, const Integral max, const size_t amount = std::numeric_limits<size_t>::max()) {
-        static_assert(std::is_integral<Integral>::value, "template parameter is not arithmetic");
-        return Random<Integral, std::uniform_int_distribution<Integral>>(min, max, amount);
+    template<class Arithmetic, class Engine = Xoshiro256PlusPlus>
+    Random<Arithmetic, detail::UniformDistribution<Arithmetic, Engine>, Engine>
+    random(const Arithmetic min, const Arithmetic max, const size_t amount = std::numeric_limits<size_t>::max()) {
+        static_assert(std::is_arithmetic<Arithmetic>::value, "template parameter is not arithmetic");
+        return Random<Arithmetic, detail::UniformDistribution<Arithmetic, Engine>, Engine>(min, max, amount);
     }
 
     /**
-     * @brief Returns a random access view object that generates a sequence of random floats, using a uniform
+     * @brief Returns a random view object that generates a reproducible sequence of random numbers, using a uniform
      * distribution.
-     * @details This random access iterator view object can be used to generate a sequence of random floats between
-     * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence (8x) of `std::random_device` as seed.
-     * @param min The minimum value, included.
-     * @param max The maximum value, included.
-     * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
-     * it is interpreted as a `while-true` loop.
-     * @return A random view object that generates a sequence of random floats.
-     */
-    template<>
-    auto random(const float min, const float max, const size_t amount) {
-        return Random<float, std::uniform_real_distribution<float>>(min, max, amount);
-    }
-
-    /**
-     * @brief Returns a random access view object that generates a sequence of random doubles, using a uniform
-     * distribution.
-     * @details This random access iterator view object can be used to generate a sequence of random doubles between
-     * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence (8x) of `std::random_device` as seed.
-     * @param min The minimum value, included.
-     * @param max The maximum value, included.
-     * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
-     * it is interpreted as a `while-true` loop.
-     * @return A random view object that generates a sequence of random doubles.
-     */
-    template<>
-    auto random(const double min, const double max, const size_t amount) {
-        return Random<double, std::uniform_real_distribution<double>>(min, max, amount);
-    }
-
-    /**
-     * @brief Returns a random access view object that generates a sequence of random long doubles, using a uniform
-     * distribution.
-     * @details This random access iterator view object can be used to generate a sequence of random long doubles
-     * between [`min, max`]. It uses the std::mt19937 random engine and a seed of (8x) `std::random_device`.
-     * @param min The minimum value, included.
+     * @details Same as `lz::random(min, max, amount)`, but the view owns an engine that is seeded with `seed`, so the
+     * same seed generates the same numbers.
+     * @tparam Arithmetic Is automatically deduced. Must be arithmetic type.
+     * @tparam Engine The random number engine, `lz::Xoshiro256PlusPlus` by default.
+     * @param min The minimum value , included.
      * @param max The maximum value, included.
-     * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<size_t>::max()`
-     * it is interpreted as a `while-true` loop.
-     * @return A random view object that generates a sequence of random long doubles.
+     * @param amount The amount of numbers to create. If equal to `std::numeric_limits<size_t>::max()` it is interpreted
+     * as a `while-true` loop.
+     * @param seed The seed of the engine.
+     * @return A random view object that generates a sequence of random numbers
      */
-    template<>
-    auto random(const long double min, const long double max, const size_t amount) {
-        return Random<long double, std::uniform_real_distribution<long double>>(min, max, amount);
+    template<class Arithmetic, class Engine = Xoshiro256PlusPlus>
+    Random<Arithmetic, detail::UniformDistribution<Arithmetic, Engine>, Engine>
+    random(const Arithmetic min, const Arithmetic max, const size_t amount, const std::uint64_t seed) {
+        static_assert(std::is_arithmetic<Arithmetic>::value, "template parameter is not arithmetic");
+        return Random<Arithmetic, detail::UniformDistribution<Arithmetic, Engine>, Engine>(min, max, amount, seed);
     }
 
     // End of group
     /**
      * @}
      */
-}
\ No newline at end of file
+}
@@ -9,10 +9,10 @@
 
 namespace lz {
     template<class Arithmetic>
-    class Range final : public detail::BasicIteratorView<detail::RangeIterator<Arithmetic>> {
+    class Range final : public detail::BasicIteratorView<Range<Arithmetic>, detail::RangeIterator<Arithmetic>> {
         Arithmetic _begin{};
-        Arithmetic _end{};
         Arithmetic _step{};
+        std::size_t _length{};
 
     public:
         using iterator = detail::RangeIterator<Arithmetic>;
@@ -21,33 +21,50 @@ namespace lz {
         using value_type = typename iterator::value_type;
 
         /**
-         * @brief Range iterator constructor from [start, end) with step.
+         * @brief Range iterator constructor from [start, end) with step. The amount of elements is computed here, once, and
+         * element `i` is `start + i * step`.
          * @param start The start of the counting.
          * @param end The end of the counting.
-         * @param step The step that gets added every iteration.
+         * @param step The step between two elements.
          */
-        Range(const Arithmetic start, const Arithmetic end, const Arithmetic step) :
+        constexpr Range(const Arithmetic start, const Arithmetic end, const Arithmetic step) :
             _begin(start),
-            _end(end),
-            _step(step) {
+            _step(step),
+            _length(detail::rangeLength(start, end, step)) {
         }
 
-        Range() = default;
+        constexpr Range() = default;
 
         /**
          * @brief Returns the beginning of the random access Range iterator
          * @return The beginning of the random access Range iterator
          */
-        iterator begin() const override {
-            return iterator(_begin, _step);
+        constexpr iterator begin() const {
+            return iterator(_begin, _step, 0);
         }
 
         /**
          * @brief Returns the ending of the random access Range iterator
          * @return The ending of the random access Range iterator
          */
-        iterator end() const override {
-            return iterator(_end, _step);
+        constexpr iterator end() const {
+            return iterator(_begin, _step, static_cast<typename iterator::difference_type>(_length));
+        }
+
+        /**
+         * @brief Returns the exact amount of elements in the range.
+         * @return The size hint of this view.
+         */
+        constexpr detail::SizeHint sizeHint() const {
+            return detail::SizeHint::exact(_length);
+        }
+
+        /**
+         * @brief Returns the amount of elements in the range, in constant time.
+         * @return The amount of elements in the range.
+         */
+        constexpr std::size_t size() const {
+            return _length;
         }
 
         /**
@@ -85,7 +102,7 @@ namespace lz {
      * `for (auto... lz::range(...))`.
      */
     template<class Arithmetic = int>
-    Range<Arithmetic> range(const Arithmetic start, const Arithmetic end, const Arithmetic step = 1) {
+    constexpr Range<Arithmetic> range(const Arithmetic start, const Arithmetic end, const Arithmetic step = 1) {
         if (step == 0) {
             throw std::range_error(fmt::format("line {}: file: {}: with a step size of 0, the sequence can never end",
                                                __LINE__, __FILE__));
@@ -113,7 +130,7 @@ namespace lz {
      * `for (auto... lz::range(...))`.
      */
     template<class Arithmetic = int>
-    Range<Arithmetic> range(const Arithmetic end) {
+    constexpr Range<Arithmetic> range(const Arithmetic end) {
         return range<Arithmetic>(0, end, 1);
     }
 
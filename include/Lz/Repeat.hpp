@@ -7,7 +7,7 @@
 
 namespace lz {
     template<class T>
-    class Repeat final : public detail::BasicIteratorView<detail::RepeatIterator<T>> {
+    class Repeat final : public detail::BasicIteratorView<Repeat<T>, detail::RepeatIterator<T>> {
     public:
         using iterator = detail::RepeatIterator<T>;
         using value_type = T;
@@ -33,7 +33,7 @@ namespace lz {
          * @brief Returns the beginning of the sequence.
          * @return The beginning of the sequence.
          */
-        iterator begin() const override {
+        iterator begin() const {
             return iterator(&_iteratorHelper, 0);
         }
 
@@ -41,9 +41,20 @@ namespace lz {
          * @brief Returns the ending of the sequence.
          * @return The ending of the sequence.
          */
-        iterator end() const override {
+        iterator end() const {
             return iterator(&_iteratorHelper, _amount);
         }
+
+        /**
+         * @brief Returns the amount of times the value is repeated, or unknown if it is a `while-true` loop.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            if (_amount == std::numeric_limits<size_t>::max()) {
+                return detail::SizeHint::unknown();
+            }
+            return detail::SizeHint::exact(_amount);
+        }
     };
 
     // Start of group
@@ -0,0 +1,99 @@
+#pragma once
+
+
+#include "detail/StreamSplitIterator.hpp"
+#include "detail/BasicIteratorView.hpp"
+#include "StringView.hpp"
+
+
+#include <istream>
+
+
+namespace lz {
+    template<class SubString, class Allocator>
+    class StreamSplitter final : public detail::BasicIteratorView<StreamSplitter<SubString, Allocator>,
+                                                                  detail::StreamSplitIterator<SubString, Allocator>> {
+    public:
+        using const_iterator = detail::StreamSplitIterator<SubString, Allocator>;
+        using iterator = const_iterator;
+
+    private:
+        mutable detail::StreamSplitIteratorHelper<Allocator> _streamSplitIteratorHelper;
+
+    public:
+        using value_type = SubString;
+
+        /**
+         * @brief Creates a stream splitter object. Its `begin()` and `end()` return an input iterator.
+         * @param stream The stream to split.
+         * @param delimiter The delimiter to split on.
+         * @param chunkSize The maximum amount of bytes that are read from the stream at once.
+         * @param allocator The allocator of the buffer.
+         */
+        StreamSplitter(std::istream& stream, std::string&& delimiter, const std::size_t chunkSize, const Allocator& allocator) :
+            _streamSplitIteratorHelper(stream, std::move(delimiter), chunkSize, allocator) {
+        }
+
+        StreamSplitter() = default;
+
+        /**
+         * @brief Reads the stream up to and including the first delimiter and returns an input iterator to the first token.
+         * The stream can only be iterated once, so this function must only be called once.
+         * @return An input stream split iterator to the beginning.
+         */
+        const_iterator begin() const {
+            _streamSplitIteratorHelper.advance();
+            return const_iterator(&_streamSplitIteratorHelper);
+        }
+
+        /**
+         * @brief Returns an input stream split iterator to the ending.
+         * @return An input stream split iterator to the ending.
+         */
+        const_iterator end() const {
+            return const_iterator(nullptr);
+        }
+
+        /**
+         * @brief The amount of tokens is unknown until the stream is exhausted.
+         * @return An unknown size hint.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::SizeHint::unknown();
+        }
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Splits a stream, such as `std::cin`, a pipe or a socket, on a delimiter, without reading the whole stream
+     * into memory first. The stream is read in chunks of at most `chunkSize` bytes into a buffer that is reused, and at most the
+     * current token and one chunk are kept in memory. Only the bytes that are available are read, so tokens are yielded as
+     * soon as they arrive; a stream that does not report what is available is read a whole chunk at a time. Tokens that
+     * straddle two chunks are handled. Its `begin()` and `end()` return an input iterator, so the stream can only be
+     * iterated once.
+     * @tparam SubString The type that gets returned when the iterator is dereferenced. `lz::StringView` by default, which
+     * points into the buffer and is only valid until the iterator is incremented. Use `std::string` to keep the tokens, e.g.
+     * when converting the view to a container.
+     * @tparam Allocator The allocator of the buffer, `std::allocator<char>` by default.
+     * @param stream The stream to split. Must outlive the returned object.
+     * @param delimiter The delimiter to split on.
+     * @param chunkSize The maximum amount of bytes that are read from the stream at once.
+     * @param allocator Optional, the allocator of the buffer, e.g. an `lz::ArenaAllocator<char>`.
+     * @return A StreamSplitter object that can be iterated over using `for (auto... lz::splitStream(...))`.
+     */
+    template<class SubString = StringView, class Allocator = std::allocator<char>>
+    StreamSplitter<SubString, Allocator> splitStream(std::istream& stream, std::string delimiter, const std::size_t chunkSize = 1 << 16,
+                                                     const Allocator& allocator = Allocator()) {
+        return StreamSplitter<SubString, Allocator>(stream, std::move(delimiter), chunkSize, allocator);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 
+#include "StringView.hpp"
 #include "detail/SplitIterator.hpp"
 #include "detail/BasicIteratorView.hpp"
 
@@ -9,16 +10,9 @@
 #include <vector>
 
 
-#ifdef CXX_LT_17
-  #include <string>
-#else
-  #include <string_view>
-#endif
-
-
 namespace lz {
     template<class SubString, class String>
-    class StringSplitter final : public detail::BasicIteratorView<detail::SplitIterator<SubString, String>> {
+    class StringSplitter final : public detail::BasicIteratorView<StringSplitter<SubString, String>, detail::SplitIterator<SubString, String>> {
     public:
         using const_iterator = detail::SplitIterator<SubString, String>;
         using iterator = const_iterator;
@@ -44,7 +38,7 @@ namespace lz {
          * @brief Returns an input string split iterator to the beginning.
          * @return A input string split iterator to the beginning.
          */
-        const_iterator begin() const override {
+        const_iterator begin() const {
             return const_iterator(0, &_splitIteratorHelper);
         }
 
@@ -52,18 +46,13 @@ namespace lz {
          * @brief Returns an input string split iterator to the ending.
          * @return A input string split iterator to the ending.
          */
-        const_iterator end() const override {
+        const_iterator end() const {
             return const_iterator(_splitIteratorHelper.string.size(), &_splitIteratorHelper);
         }
     };
 
-#ifdef CXX_LT_17
-    template class StringSplitter<std::string, std::string>;
-    template<class SubString = std::string, class String = std::string>
-#else
-    template class StringSplitter<std::string_view, std::string_view>;
-    template<class SubString = std::string_view, class String = std::string_view>
-#endif
+    template class StringSplitter<StringView, StringView>;
+    template<class SubString = StringView, class String = StringView>
     // Start of group
     /**
      * @addtogroup ItFns
@@ -71,11 +60,11 @@ namespace lz {
      */
 
     /**
-     * @brief This is a lazy evaluated string splitter function. If not using C++17 or higher, you can use `std::move`
-     * to safely move the substring, that is returned by the
-     * `StringSplitter<SubString>::const_iterator::operator*`. Its `begin()` and `end()` return an input iterator.
+     * @brief This is a lazy evaluated string splitter function. The substrings point into `str`, so splitting does not
+     * allocate. Its `begin()` and `end()` return an input iterator.
      * @tparam SubString The type that gets returned when the `StringSplitter<SubString>::const_iterator::operator*` is
-     * called. Can be specified, but if C++17 or higher is defined, `std::string_view` is used, otherwise `std::string`.
+     * called. `lz::StringView` by default, which is `std::string_view` from C++17 on. Specify `std::string` to get a
+     * copy of every substring.
      * @param str The string to split.
      * @param delimiter The delimiter to split on.
      * @return A stringSplitter object that can be converted to an arbitrary container or can be iterated over using
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "detail/LzTools.hpp"
+
+#ifndef CXX_LT_17
+  #include <string_view>
+#endif
+
+
+namespace lz {
+#ifndef CXX_LT_17
+    using StringView = std::string_view;
+#else
+    /**
+     * A non owning, read only view of a sequence of `char`s, used where `std::string_view` is not available. It has the
+     * subset of the `std::string_view` interface that is needed to split and compare strings. The viewed characters must
+     * outlive the view. From C++17 on, `lz::StringView` is `std::string_view`.
+     */
+    class StringView {
+        const char* _data{};
+        std::size_t _size{};
+
+    public:
+        using value_type = char;
+        using traits_type = std::char_traits<char>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = const char&;
+        using reference = const_reference;
+        using const_pointer = const char*;
+        using pointer = const_pointer;
+        using const_iterator = const char*;
+        using iterator = const_iterator;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        constexpr StringView() noexcept = default;
+
+        constexpr StringView(const char* data, const size_type size) noexcept :
+            _data(data),
+            _size(size) {
+        }
+
+        StringView(const char* string) noexcept : // NOLINT(google-explicit-constructor)
+            _data(string),
+            _size(traits_type::length(string)) {
+        }
+
+        template<class Allocator>
+        StringView(const std::basic_string<char, traits_type, Allocator>& string) noexcept : // NOLINT(google-explicit-constructor)
+            _data(string.data()),
+            _size(string.size()) {
+        }
+
+        template<class Allocator>
+        explicit operator std::basic_string<char, traits_type, Allocator>() const {
+            return std::basic_string<char, traits_type, Allocator>(_data, _size);
+        }
+
+        constexpr const_iterator begin() const noexcept {
+            return _data;
+        }
+
+        constexpr const_iterator end() const noexcept {
+            return _data + _size;
+        }
+
+        constexpr const_pointer data() const noexcept {
+            return _data;
+        }
+
+        constexpr size_type size() const noexcept {
+            return _size;
+        }
+
+        constexpr size_type length() const noexcept {
+            return _size;
+        }
+
+        constexpr bool empty() const noexcept {
+            return _size == 0;
+        }
+
+        constexpr const_reference operator[](const size_type index) const noexcept {
+            return _data[index];
+        }
+
+        constexpr const_reference front() const noexcept {
+            return _data[0];
+        }
+
+        constexpr const_reference back() const noexcept {
+            return _data[_size - 1];
+        }
+
+        void remove_prefix(const size_type count) noexcept {
+            _data += count;
+            _size -= count;
+        }
+
+        void remove_suffix(const size_type count) noexcept {
+            _size -= count;
+        }
+
+        StringView substr(const size_type position = 0, const size_type count = npos) const {
+            if (position > _size) {
+                throw std::out_of_range("lz::StringView::substr: position is out of range");
+            }
+            return StringView(_data + position, count < _size - position ? count : _size - position);
+        }
+
+        int compare(const StringView other) const noexcept {
+            const int result = traits_type::compare(_data, other._data, _size < other._size ? _size : other._size);
+            if (result != 0) {
+                return result;
+            }
+            return _size == other._size ? 0 : _size < other._size ? -1 : 1;
+        }
+
+        size_type find(const char character, const size_type position = 0) const noexcept {
+            if (position >= _size) {
+                return npos;
+            }
+            const char* found = traits_type::find(_data + position, _size - position, character);
+            return found == nullptr ? npos : static_cast<size_type>(found - _data);
+        }
+
+        // The operators are hidden friends that take views by value, so that e.g. `view == "text"` converts the literal
+        friend bool operator==(const StringView lhs, const StringView rhs) noexcept {
+            return lhs._size == rhs._size && traits_type::compare(lhs._data, rhs._data, lhs._size) == 0;
+        }
+
+        friend bool operator!=(const StringView lhs, const StringView rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const StringView lhs, const StringView rhs) noexcept {
+            return lhs.compare(rhs) < 0;
+        }
+
+        friend bool operator>(const StringView lhs, const StringView rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const StringView lhs, const StringView rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const StringView lhs, const StringView rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+        friend std::ostream& operator<<(std::ostream& stream, const StringView view) {
+            return stream.write(view._data, static_cast<std::streamsize>(view._size));
+        }
+    };
+#endif
+}
+
+#ifdef CXX_LT_17
+namespace std {
+    template<>
+    struct hash<lz::StringView> {
+        // FNV-1a, std::hash<std::string> cannot be used without copying the characters
+        std::size_t operator()(const lz::StringView view) const noexcept {
+            std::size_t hash = sizeof(std::size_t) == 8 ? static_cast<std::size_t>(0xcbf29ce484222325ull) : 0x811c9dc5u;
+            const std::size_t prime = sizeof(std::size_t) == 8 ? static_cast<std::size_t>(0x100000001b3ull) : 0x01000193u;
+            for (const char c : view) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * prime;
+            }
+            return hash;
+        }
+    };
+}
+
+template<>
+struct fmt::formatter<lz::StringView> : fmt::formatter<fmt::string_view> {
+    template<class FormatContext>
+    auto format(const lz::StringView view, FormatContext& context) -> decltype(context.out()) {
+        return fmt::formatter<fmt::string_view>::format(fmt::string_view(view.data(), view.size()), context);
+    }
+};
+#endif
@@ -3,21 +3,113 @@
 #include <vector>
 #include <array>
 
-#include "detail/TakeIterator.hpp"
+#include "detail/TakeWhileIterator.hpp"
 #include "detail/BasicIteratorView.hpp"
+#include "detail/Pipe.hpp"
 
 
 namespace lz {
+    template<class Iterator>
+    class Take final : public detail::BasicIteratorView<Take<Iterator>, Iterator> {
+    public:
+        using iterator = Iterator;
+        using const_iterator = iterator;
+
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        using reference = typename std::iterator_traits<Iterator>::reference;
+
+    private:
+        Iterator _begin{};
+        Iterator _end{};
+        detail::SizeHint _sizeHint{};
+
+    public:
+        /**
+         * @brief Takes the elements [begin, end). The iterators of this view are the iterators that are passed, so iterating
+         * over it is as cheap as iterating over [begin, end) directly.
+         * @param begin The beginning of the iterator.
+         * @param end The ending of the iterator.
+         * @param size The amount of elements between `begin` and `end`.
+         */
+        Take(const Iterator begin, const Iterator end, const size_t size) :
+            _begin(begin),
+            _end(end),
+            _sizeHint(detail::SizeHint::exact(size)) {
+        }
+
+        /**
+         * @brief Takes the elements [begin, end). The amount of elements is only known up front if `Iterator` is a random
+         * access iterator, otherwise it is counted when `size()` is called.
+         * @param begin The beginning of the iterator.
+         * @param end The ending of the iterator.
+         */
+        Take(const Iterator begin, const Iterator end) :
+            _begin(begin),
+            _end(end),
+            _sizeHint(detail::sizeHintOf(begin, end)) {
+        }
+
+        Take() = default;
+
+        /**
+         * @brief Returns the beginning of the iterator.
+         * @return The beginning of the iterator.
+         */
+        iterator begin() const {
+            return _begin;
+        }
+
+        /**
+         * @brief Returns the ending of the iterator.
+         * @return The ending of the iterator.
+         */
+        iterator end() const {
+            return _end;
+        }
+
+        /**
+         * @brief Returns the amount of elements of this view. This is done in constant time, unless this view was created
+         * by `lz::takerange` over iterators that are not random access, in which case the elements are counted. This
+         * function must not be called for such views over input iterators, as counting would consume them.
+         * @return The amount of elements of this view.
+         */
+        size_t size() const {
+            if (_sizeHint.kind == detail::SizeHintKind::Exact) {
+                return _sizeHint.size;
+            }
+            const auto size = std::distance(_begin, _end);
+            return size > 0 ? static_cast<size_t>(size) : 0;
+        }
+
+        /**
+         * @brief Returns the `index`th element of this view. Only available if `Iterator` is a random access iterator.
+         * @param index The index of the element.
+         * @return A reference to the element.
+         */
+        reference operator[](const size_t index) const {
+            return _begin[static_cast<typename std::iterator_traits<Iterator>::difference_type>(index)];
+        }
+
+        /**
+         * @brief Returns the exact amount of elements of this view, or an unknown size hint if it has not been counted.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return _sizeHint;
+        }
+    };
+
     template<class Iterator, class Function>
-    class Take final : public detail::BasicIteratorView<detail::TakeIterator<Iterator, Function>> {
+    class TakeWhile final : public detail::BasicIteratorView<TakeWhile<Iterator, Function>,
+                                                             detail::TakeWhileIterator<Iterator, Function>> {
     public:
-        using iterator = detail::TakeIterator<Iterator, Function>;
+        using iterator = detail::TakeWhileIterator<Iterator, Function>;
         using const_iterator = iterator;
 
         using value_type = typename std::iterator_traits<Iterator>::value_type;
 
     private:
-        std::function<value_type(value_type)> _predicate{};
+        detail::FunctionContainer<Function> _predicate{};
         Iterator _begin{};
         Iterator _end{};
 
@@ -30,28 +122,36 @@ namespace lz {
          * @param predicate Function that must contain a the value type in its arguments and must return a bool. If the
          * function returns false, the iterator stops.
          */
-        Take(const Iterator begin, const Iterator end, const Function& predicate) :
+        TakeWhile(const Iterator begin, const Iterator end, const Function& predicate) :
             _predicate(predicate),
             _begin(begin),
             _end(end) {
         }
 
-        Take() = default;
+        TakeWhile() = default;
 
         /**
          * @brief Returns the beginning of the iterator.
          * @return The beginning of the iterator.
          */
-        iterator begin() const override {
-            return iterator(_begin, _end, &_predicate);
+        iterator begin() const {
+            return iterator(_begin, _end, _predicate);
         }
 
         /**
          * @brief Returns the ending of the iterator.
          * @return The ending of the iterator.
          */
-        iterator end() const override {
-            return iterator(_end, _end, &_predicate);
+        iterator end() const {
+            return iterator(_end, _end, _predicate);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, as the predicate may stop the iteration earlier.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
         }
     };
 
@@ -76,12 +176,12 @@ namespace lz {
      * @param end The beginning of the iterator.
      * @param predicate A function that returns a bool and passes a value type in its argument. If the function returns
      * false, the iterator stops.
-     * @return A Take object that can be converted to an arbitrary container or can be iterated over using
+     * @return A TakeWhile object that can be converted to an arbitrary container or can be iterated over using
      * `for (auto... lz::takewhilerange(...))`.
      */
     template<class Iterator, class Function>
-    Take<Iterator, Function> takewhilerange(const Iterator begin, const Iterator end, const Function& predicate) {
-        return Take<Iterator, Function>(begin, end, predicate);
+    TakeWhile<Iterator, Function> takewhilerange(const Iterator begin, const Iterator end, const Function& predicate) {
+        return TakeWhile<Iterator, Function>(begin, end, predicate);
     }
 
     /**
@@ -92,18 +192,18 @@ namespace lz {
      * @param iterable An object that has methods `begin()` and `end()`.
      * @param predicate A function that returns a bool and passes a value type in its argument. If the function returns
      * false, the iterator stops.
-     * @return A Take object that can be converted to an arbitrary container or can be iterated over using
+     * @return A TakeWhile object that can be converted to an arbitrary container or can be iterated over using
      * `for (auto... lz::takewhile(...))`.
      */
     template<class Iterable, class Function>
-    auto takewhile(Iterable&& iterable, const Function& predicate) -> Take<decltype(std::begin(iterable)), Function> {
+    auto takewhile(Iterable&& iterable, const Function& predicate) -> TakeWhile<decltype(std::begin(iterable)), Function> {
         return takewhilerange(std::begin(iterable), std::end(iterable), predicate);
     }
 
     /**
-     * @brief This function takes a range between two iterators from [begin, end). Its `begin()` function returns a
-     * random access iterator. If MSVC and the type is an STL iterator, pass a pointer iterator, not an actual
-     * iterator object.
+     * @brief This function takes a range between two iterators from [begin, end). Its `begin()` function returns
+     * `begin`, so no extra work is done while iterating. If `Iterator` is not a random access iterator, the elements are
+     * not counted here, but only when `size()` is called, so input iterators are not consumed.
      * @tparam Iterator Is automatically deduced.
      * @param begin The beginning of the 'view'.
      * @param end The ending of the 'view'.
@@ -111,15 +211,14 @@ namespace lz {
      * `for (auto... lz::takerange(...))`.
      */
     template<class Iterator>
-    auto takerange(const Iterator begin, const Iterator end) {
-        using ValueType = typename std::iterator_traits<Iterator>::value_type;
-        return takewhilerange(begin, end, [](const ValueType&) { return true; });
+    Take<Iterator> takerange(const Iterator begin, const Iterator end) {
+        return Take<Iterator>(begin, end);
     }
 
     /**
      * @brief This function takes an iterable and slices `amount` from the beginning of the array. Essentially it is
-     * equivalent to [`iterable.begin(), iterable.begin() + amount`). Its `begin()` function returns a random
-     * access iterator.
+     * equivalent to [`iterable.begin(), iterable.begin() + amount`). Its `begin()` function returns the iterator of
+     * `iterable`.
      * @tparam Iterable Is automatically deduced.
      * @param iterable An iterable with method `begin()`.
      * @param amount The amount of elements to take from the beginning of the `iterable`.
@@ -127,25 +226,51 @@ namespace lz {
      * `for (auto... lz::take(...))`.
      */
     template<class Iterable>
-    auto take(Iterable&& iterable, const size_t amount) -> decltype(takerange(std::begin(iterable), std::begin(iterable))) {
+    auto take(Iterable&& iterable, const size_t amount) -> Take<decltype(std::begin(iterable))> {
         auto begin = std::begin(iterable);
-        return takerange(begin, std::next(begin, amount));
+        return Take<decltype(begin)>(begin, std::next(begin, static_cast<std::ptrdiff_t>(amount)), amount);
+    }
+
+    namespace detail {
+        class TakeAdaptor : public PipeAdaptor {
+            size_t _amount;
+
+        public:
+            explicit TakeAdaptor(const size_t amount) :
+                _amount(amount) {
+            }
+
+            template<class Iterable>
+            auto operator()(Iterable&& iterable) const -> decltype(lz::take(std::forward<Iterable>(iterable), _amount)) {
+                return lz::take(std::forward<Iterable>(iterable), _amount);
+            }
+        };
+    }
+
+    /**
+     * @brief Returns an adaptor to take the first `amount` elements of an iterable with, e.g. `vector | lz::take(3)`,
+     * which is the same as `lz::take(vector, 3)`.
+     * @param amount The amount of elements to take from the beginning of the iterable.
+     * @return An adaptor that can be used on the right hand side of `|`.
+     */
+    inline detail::TakeAdaptor take(const size_t amount) {
+        return detail::TakeAdaptor(amount);
     }
 
     /**
      * @brief This function slices an iterable. It is equivalent to [`begin() + from, begin() + to`).
-     * Its `begin()` function returns a random access iterator.
+     * Its `begin()` function returns the iterator of `iterable`.
      * @tparam Iterable Is automatically deduced.
      * @param iterable An iterable with method `begin()`.
      * @param from The offset from the beginning of the iterable.
-     * @param to The offset from the beginning to take. `from` must be higher than `to`.
+     * @param to The offset from the beginning to take. `to` must be higher than `from`.
      * @return A Take object that can be converted to an arbitrary container or can be iterated over using
      * `for (auto... lz::slice(...))`.
      */
     template<class Iterable>
-    auto slice(Iterable&& iterable, const size_t from, const size_t to) -> decltype(takerange(std::begin(iterable), std::begin(iterable))) {
-        auto begin = std::begin(iterable);
-        return takerange(std::next(begin, from), std::next(begin, to));
+    auto slice(Iterable&& iterable, const size_t from, const size_t to) -> Take<decltype(std::begin(iterable))> {
+        auto begin = std::next(std::begin(iterable), static_cast<std::ptrdiff_t>(from));
+        return Take<decltype(begin)>(begin, std::next(begin, static_cast<std::ptrdiff_t>(to - from)), to - from);
     }
 
     // End of group
@@ -7,7 +7,7 @@
 
 namespace lz {
     template<class Iterator>
-    class TakeEvery final : public detail::BasicIteratorView<detail::TakeEveryIterator<Iterator>> {
+    class TakeEvery final : public detail::BasicIteratorView<TakeEvery<Iterator>, detail::TakeEveryIterator<Iterator>> {
     public:
         using iterator = detail::TakeEveryIterator<Iterator>;
         using const_iterator = iterator;
@@ -40,7 +40,7 @@ namespace lz {
          * @brief Returns the beginning of the iterator.
          * @return The beginning of the iterator.
          */
-        iterator begin() const override {
+        iterator begin() const {
             return iterator(_begin, _end, _offset, _distance);
         }
 
@@ -48,9 +48,17 @@ namespace lz {
          * @brief Returns the ending of the iterator.
          * @return The ending of the iterator.
          */
-        iterator end() const override {
+        iterator end() const {
             return iterator(_end, _end, _offset, _distance);
         }
+
+        /**
+         * @brief Returns the exact amount of elements that are taken.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::SizeHint::exact(_offset == 0 ? 0 : (_distance + _offset - 1) / _offset);
+        }
     };
 
     // Start of group
@@ -6,7 +6,7 @@
 
 namespace lz {
     template<class Iterator>
-    class Unique final : public detail::BasicIteratorView<detail::UniqueIterator<Iterator>> {
+    class Unique final : public detail::BasicIteratorView<Unique<Iterator>, detail::UniqueIterator<Iterator>> {
     public:
         using iterator = detail::UniqueIterator<Iterator>;
         using const_iterator = iterator;
@@ -47,6 +47,14 @@ namespace lz {
         iterator end() const {
             return iterator(_end, _end);
         }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, the length of the sequence.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
+        }
     };
 
     // Start of group
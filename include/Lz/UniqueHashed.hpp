@@ -0,0 +1,125 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/UniqueHashedIterator.hpp"
+
+
+namespace lz {
+    template<class Iterator, class Hash, class KeyEqual, class Allocator>
+    class UniqueHashed final : public detail::BasicIteratorView<UniqueHashed<Iterator, Hash, KeyEqual, Allocator>,
+                                                                detail::UniqueHashedIterator<Iterator, Hash, KeyEqual, Allocator>> {
+    public:
+        using iterator = detail::UniqueHashedIterator<Iterator, Hash, KeyEqual, Allocator>;
+        using const_iterator = iterator;
+        using value_type = typename iterator::value_type;
+
+    private:
+        Iterator _begin{};
+        Iterator _end{};
+        Hash _hash{};
+        KeyEqual _keyEqual{};
+        Allocator _allocator{};
+
+    public:
+        /**
+         * @brief Creates an UniqueHashed iterator view object.
+         * @details Use this iterator view to get the unique values of a sequence, in the order of their first occurrence.
+         * The values that were seen are kept in a hash set, so the sequence is not sorted nor modified.
+         * @param begin The beginning of the sequence.
+         * @param end The ending of the sequence.
+         * @param hash The hash function of the values.
+         * @param keyEqual The function that checks whether two values are equal.
+         * @param allocator The allocator of the hash set.
+         */
+        UniqueHashed(const Iterator begin, const Iterator end, Hash hash, KeyEqual keyEqual, const Allocator& allocator) :
+            _begin(begin),
+            _end(end),
+            _hash(std::move(hash)),
+            _keyEqual(std::move(keyEqual)),
+            _allocator(allocator) {
+        }
+
+        UniqueHashed() = default;
+
+        /**
+         * @brief Returns the beginning of the sequence.
+         * @return The beginning of the sequence.
+         */
+        iterator begin() const {
+            return iterator(_begin, _end, _hash, _keyEqual, _allocator);
+        }
+
+        /**
+         * @brief Returns the ending of the sequence.
+         * @return The ending of the sequence.
+         */
+        iterator end() const {
+            return iterator(_end, _end, _hash, _keyEqual, _allocator);
+        }
+
+        /**
+         * @brief Returns an upper bound of the amount of elements, the length of the sequence.
+         * @return The size hint of this view.
+         */
+        detail::SizeHint sizeHint() const {
+            return detail::upperBoundOf(_begin, _end);
+        }
+    };
+
+    // Start of group
+    /**
+     * @addtogroup ItFns
+     * @{
+     */
+
+    /**
+     * @brief Returns an UniqueHashed iterator view object.
+     * @details Unlike `lz::uniquerange`, this view does not sort the sequence. It yields every value the first time it
+     * occurs, in expected O(n) time, and works on input iterators. The values that were seen are copied into a flat hash
+     * set, which is shared by copies of an iterator, so the iterators of this view are input iterators.
+     * @tparam Iterator Is automatically deduced.
+     * @param begin The beginning of the sequence.
+     * @param end The ending of the sequence.
+     * @param hash The hash function of the values, `std::hash` by default.
+     * @param keyEqual The function that checks whether two values are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the hash set.
+     * @return An UniqueHashed iterator view object, which can be used to iterate over in a `(for ... : uniqueHashedRange(...))`
+     * fashion.
+     */
+    template<class Iterator, class ValueType = typename std::iterator_traits<Iterator>::value_type,
+        class Hash = std::hash<ValueType>, class KeyEqual = std::equal_to<ValueType>, class Allocator = std::allocator<ValueType>>
+    UniqueHashed<Iterator, Hash, KeyEqual, Allocator>
+    uniqueHashedRange(const Iterator begin, const Iterator end, Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(),
+                      const Allocator& allocator = Allocator()) {
+        return UniqueHashed<Iterator, Hash, KeyEqual, Allocator>(begin, end, std::move(hash), std::move(keyEqual), allocator);
+    }
+
+    /**
+     * @brief Returns an UniqueHashed iterator view object.
+     * @details Unlike `lz::unique`, this view does not sort the sequence. It yields every value the first time it occurs,
+     * in expected O(n) time, and works on input iterators. The values that were seen are copied into a flat hash set,
+     * which is shared by copies of an iterator, so the iterators of this view are input iterators.
+     * @tparam Iterable Is automatically deduced.
+     * @param iterable The iterable sequence.
+     * @param hash The hash function of the values, `std::hash` by default.
+     * @param keyEqual The function that checks whether two values are equal, `std::equal_to` by default.
+     * @param allocator The allocator of the hash set.
+     * @return An UniqueHashed iterator view object, which can be used to iterate over in a `(for ... : uniqueHashed(...))`
+     * fashion.
+     */
+    template<class Iterable, class ValueType = detail::ValueTypeIterable<Iterable>, class Hash = std::hash<ValueType>,
+        class KeyEqual = std::equal_to<ValueType>, class Allocator = std::allocator<ValueType>>
+    auto uniqueHashed(Iterable&& iterable, Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(),
+                      const Allocator& allocator = Allocator())
+    -> UniqueHashed<decltype(std::begin(iterable)), Hash, KeyEqual, Allocator> {
+        return uniqueHashedRange(std::begin(iterable), std::end(iterable), std::move(hash), std::move(keyEqual), allocator);
+    }
+
+    // End of group
+    /**
+     * @}
+     */
+}
@@ -9,7 +9,7 @@
 
 namespace lz {
     template<class... Iterators>
-    class Zip final : public detail::BasicIteratorView<detail::ZipIterator<Iterators...>> {
+    class Zip final : public detail::BasicIteratorView<Zip<Iterators...>, detail::ZipIterator<Iterators...>> {
     public:
         using iterator = detail::ZipIterator<Iterators...>;
         using const_iterator = iterator;
@@ -45,7 +45,7 @@ namespace lz {
          * @brief Returns the beginning of the zip iterator.
          * @return The beginning of the zip iterator.
          */
-        iterator begin() const override {
+        iterator begin() const {
             return iterator(_begin);
         }
 
@@ -53,7 +53,7 @@ namespace lz {
          * @brief Returns the ending of the zip iterator.
          * @return The ending of the zip iterator.
          */
-        iterator end() const override {
+        iterator end() const {
             return iterator(_end);
         }
     };
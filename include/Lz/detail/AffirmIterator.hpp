@@ -1,13 +1,14 @@
 #pragma once
 
 #include <iterator>
-#include <functional>
+
+#include "LzTools.hpp"
 
 
 namespace lz { namespace detail {
-    template<class Iterator, class Exception, class ValueType>
+    template<class Function, class Exception>
     struct AffirmIteratorHelper {
-        std::function<bool(ValueType)> _predicate{};
+        FunctionContainer<Function> _predicate{};
         Exception _exception{};
     };
 
@@ -24,10 +25,10 @@ namespace lz { namespace detail {
 
     private:
         Iterator _iterator{};
-        const AffirmIteratorHelper<Iterator, Exception, value_type>* _helper{};
+        const AffirmIteratorHelper<Function, Exception>* _helper{};
 
     public:
-        AffirmIterator(const Iterator iterator, const AffirmIteratorHelper<Iterator, Exception, value_type>* helper) :
+        AffirmIterator(const Iterator iterator, const AffirmIteratorHelper<Function, Exception>* helper) :
             _iterator(iterator),
             _helper(helper) {
         }
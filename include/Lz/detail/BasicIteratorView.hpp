@@ -9,21 +9,151 @@
 #include <unordered_map>
 #include <numeric>
 #include <algorithm>
+#include <cstring>
 
 #include "fmt/ostream.h"
 
+#include "FlatHashMap.hpp"
+#include "JoinIterator.hpp"
+#include "ForEachChunk.hpp"
+#include "ForEachSegment.hpp"
 #include "LzTools.hpp"
+#include "Parallel.hpp"
 
 
 namespace lz { namespace detail {
-    template<class Iterator>
+    /**
+     * Base class of all views. `Derived` must implement `begin()` and `end()`, which are resolved at compile time (CRTP), so
+     * views do not carry a vtable and stay literal types when their members are.
+     */
+    template<class Derived, class Iterator>
     class BasicIteratorView {
+        constexpr const Derived& derived() const {
+            return static_cast<const Derived&>(*this);
+        }
+
+        constexpr Iterator begin() const {
+            return derived().begin();
+        }
+
+        constexpr Iterator end() const {
+            return derived().end();
+        }
+
+        template<class Container>
+        void copyTo(Container& container) const {
+            detail::reserve(container, derived().sizeHint());
+            auto out = detail::makeInserter(container);
+            auto copySegment = [&out](const auto first, const auto last) {
+                out = std::copy(first, last, out);
+            };
+            visitSegments(begin(), end(), copySegment);
+        }
+
+        template<class Container, class... Args>
+        Container createContainer(std::true_type /*hasReserve*/, Args&& ... args) const {
+            Container container(std::forward<Args>(args)...);
+            copyTo(container);
+            return container;
+        }
+
+        template<class Container, class... Args>
+        Container createContainer(std::false_type /*hasReserve*/, Args&& ... args) const {
+            return Container(begin(), end(), std::forward<Args>(args)...);
+        }
+
+        // Contiguous sequences are passed as pointers, which the standard library copies with memmove where it can
+        template<class Container, class... Args>
+        Container constructFrom(std::true_type /*isContiguous*/, Args&& ... args) const {
+            const auto first = data();
+            return Container(first, first + size(), std::forward<Args>(args)...);
+        }
+
+        // Every segment is inserted as a range, so that segments over contiguous storage are copied with memmove as well
+        template<class Container, class... Args>
+        Container constructFrom(std::false_type /*isContiguous*/, Args&& ... args) const {
+            Container container(std::forward<Args>(args)...);
+            container.reserve(derived().sizeHint().size);
+            auto appendSegment = [&container](const auto first, const auto last) {
+                container.insert(container.end(), first, last);
+            };
+            visitSegments(begin(), end(), appendSegment);
+            return container;
+        }
+
+        template<class OutputIterator>
+        void copyToArray(OutputIterator out, std::true_type /*isMemcpyable*/) const {
+            if (const auto length = size()) {
+                std::memcpy(&*out, data(), length * sizeof(value_type));
+            }
+        }
+
+        template<class OutputIterator>
+        void copyToArray(OutputIterator out, std::false_type /*isMemcpyable*/) const {
+            auto copySegment = [&out](const auto first, const auto last) {
+                out = std::copy(first, last, out);
+            };
+            visitSegments(begin(), end(), copySegment);
+        }
+
+        template<class Allocator>
+        std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>
+        createVector(const Allocator& alloc, std::true_type /*isRandomAccess*/) const {
+            if (derived().sizeHint().kind == SizeHintKind::Exact) {
+                using Vector = std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>;
+                return constructFrom<Vector>(IsContiguous<Iterator>(), alloc);
+            }
+            return createVector(alloc, std::false_type());
+        }
+
+        template<class Allocator>
+        std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>
+        createVector(const Allocator& alloc, std::false_type /*isRandomAccess*/) const {
+            std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator> vector(alloc);
+            copyTo(vector);
+            return vector;
+        }
+
+        template<class Allocator>
+        std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>
+        createVector(const ParallelPolicy policy, const Allocator& alloc, std::true_type /*isRandomAccess*/) const {
+            using Vector = std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>;
+            using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+
+            const SizeHint hint = derived().sizeHint();
+            if (hint.kind != SizeHintKind::Exact || chunkCount(policy, hint.size) == 1) {
+                return createVector(alloc, std::true_type());
+            }
+
+            const Iterator first = begin();
+            Vector vector(hint.size, alloc);
+            const auto out = vector.begin();
+
+            parallelChunks(policy, hint.size, [first, out](const std::size_t from, const std::size_t to) {
+                std::copy(first + static_cast<DifferenceType>(from), first + static_cast<DifferenceType>(to),
+                          out + static_cast<typename Vector::difference_type>(from));
+                return to - from;
+            });
+            return vector;
+        }
+
+        template<class Allocator>
+        std::vector<typename std::iterator_traits<Iterator>::value_type, Allocator>
+        createVector(const ParallelPolicy /*policy*/, const Allocator& alloc, std::false_type /*isRandomAccess*/) const {
+            return createVector(alloc, std::false_type());
+        }
+
         template<class MapType, class Allocator, class KeySelectorFunc>
         MapType createMap(KeySelectorFunc keyGen, const Allocator& allocator) {
             MapType map(allocator);
-            std::transform(begin(), end(), std::inserter(map, map.end()), [keyGen](const value_type& value) {
-                return std::make_pair(keyGen(value), value);
-            });
+            detail::reserve(map, derived().sizeHint());
+            auto insertSegment = [&map, &keyGen](auto first, const auto last) {
+                for (; first != last; ++first) {
+                    const value_type& value = *first;
+                    map.emplace(keyGen(value), value);
+                }
+            };
+            visitSegments(begin(), end(), insertSegment);
             return map;
         }
 
@@ -35,11 +165,57 @@ namespace lz { namespace detail {
         using KeyType = detail::FunctionReturnType<KeySelectorFunc, value_type>;
 
     public:
-        virtual Iterator begin() const = 0;
+        /**
+         * @brief Returns the amount of elements this view yields, if it can be determined without iterating over it.
+         * @details Views that know their exact length (e.g. `lz::range`) return `SizeHintKind::Exact`, views that may skip
+         * elements (e.g. `lz::filter`) return `SizeHintKind::UpperBound` and all others `SizeHintKind::Unknown`. The
+         * materializers use this to allocate their storage once.
+         * @return The size hint of this view.
+         */
+        SizeHint sizeHint() const {
+            return sizeHintOf(begin(), end());
+        }
 
-        virtual Iterator end() const = 0;
+        /**
+         * @brief Returns a pointer to the first element. Only available if the iterator of this view points to contiguous
+         * storage, which is the case for e.g. `lz::take`, `lz::slice` and `lz::dropwhile` over a `std::vector`, `std::array`
+         * or `std::string`. The view then is a plain span that can be passed to `memcpy`-like functions.
+         * @return A pointer to the first element, or `nullptr` if the view is empty.
+         */
+        template<class I = Iterator, class = std::enable_if_t<IsContiguous<I>::value>>
+        std::remove_reference_t<typename std::iterator_traits<I>::reference>* data() const {
+            const Iterator first = begin();
+            return first == end() ? nullptr : std::addressof(*first);
+        }
 
-        virtual ~BasicIteratorView() = default;
+        /**
+         * @brief Returns the amount of elements, in constant time. Only available if the iterator of this view points to
+         * contiguous storage, see `data()`.
+         * @return The amount of elements.
+         */
+        template<class I = Iterator, class = std::enable_if_t<IsContiguous<I>::value>>
+        std::size_t size() const {
+            return static_cast<std::size_t>(end() - begin());
+        }
+
+        /**
+         * @brief Passes the elements of this view in chunks, by calling `sink(const value_type* data, std::size_t count)`
+         * until all elements have been passed. The view must be finite.
+         * @details Sources such as `lz::range`, `lz::repeat`, `lz::concat` and views over contiguous storage produce whole
+         * chunks at once, and `lz::map` and `lz::filter` transform such chunks in tight loops that the compiler can vectorize.
+         * Other views are copied to a buffer, a chunk at a time. Example:
+         * ```cpp
+         * long long sum = 0;
+         * lz::map(lz::range(1000), [](const int i) { return i * i; }).forEachChunk([&sum](const int* data, std::size_t count) {
+         *     sum = std::accumulate(data, data + count, sum);
+         * });
+         * ```
+         * @param sink The function that receives the chunks. The pointer is only valid during the call.
+         */
+        template<class Sink>
+        void forEachChunk(Sink sink) const {
+            visitChunks(begin(), end(), sink);
+        }
 
         /**
          * @brief Returns an arbitrary container type, of which its constructor signature looks like:
@@ -58,7 +234,8 @@ namespace lz { namespace detail {
          */
         template<template<class, class...> class Container, class... Args>
         Container<value_type, Args...> to(Args&& ... args) const {
-            return Container<value_type, Args...>(begin(), end(), std::forward<Args>(args)...);
+            using Result = Container<value_type, Args...>;
+            return createContainer<Result>(HasReserve<Result>(), std::forward<Args>(args)...);
         }
 
         /**
@@ -67,7 +244,7 @@ namespace lz { namespace detail {
          * @return A `std::vector<value_type>` with the sequence.
          */
         std::vector<value_type> toVector() const {
-            return std::vector<value_type>(begin(), end());
+            return toVector(std::allocator<value_type>());
         }
 
         /**
@@ -80,7 +257,25 @@ namespace lz { namespace detail {
          */
         template<class Allocator>
         std::vector<value_type, Allocator> toVector(const Allocator& alloc = Allocator()) const {
-            return std::vector<value_type, Allocator>(begin(), end(), alloc);
+            return createVector(alloc, IsRandomAccess<Iterator>());
+        }
+
+        /**
+         * @brief Creates a new `std::vector<value_type, Allocator>`, using multiple threads.
+         * @details If the view is random access and its length is known, the vector is allocated once and every thread
+         * copies its own chunk of the sequence into it. `value_type` must be default constructible and dereferencing the
+         * iterator must be thread safe. Other views are converted sequentially. Example:
+         * ```cpp
+         * auto squares = lz::map(lz::range(1000000), [](const int i) { return i * i; }).toVector(lz::par);
+         * ```
+         * @tparam Allocator Is automatically deduced.
+         * @param policy The parallel execution policy, for e.g. `lz::par`.
+         * @param alloc The allocator.
+         * @return A new `std::vector<value_type, Allocator>`.
+         */
+        template<class Allocator = std::allocator<value_type>>
+        std::vector<value_type, Allocator> toVector(const ParallelPolicy policy, const Allocator& alloc = Allocator()) const {
+            return createVector(policy, alloc, IsRandomAccess<Iterator>());
         }
 
         /**
@@ -101,7 +296,8 @@ namespace lz { namespace detail {
             }
 
             std::array<value_type, N> container;
-            std::copy(b, e, std::begin(container));
+            copyToArray(std::begin(container), std::integral_constant<bool, IsContiguous<Iterator>::value &&
+                                                                            std::is_trivially_copyable<value_type>::value>());
             return container;
         }
 
@@ -165,41 +361,91 @@ namespace lz { namespace detail {
             class Allocator = std::allocator<std::pair<const KeyType<KeySelectorFunc>, value_type>>>
         std::unordered_map<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator>
         toUnorderedMap(KeySelectorFunc keyGen, const Allocator& allocator = Allocator()) {
-            using UnorderedMap = std::unordered_map<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality>;
+            using UnorderedMap = std::unordered_map<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator>;
             return createMap<UnorderedMap>(keyGen, allocator);
         }
 
+        /**
+         * @brief Creates a new `lz::FlatHashMap<Key, value_type[, Hasher[, KeyEquality[, Allocator]]]>`.
+         * @details Creates a new `lz::FlatHashMap<Key, value_type[, Hasher[, KeyEquality[, Allocator]]]>`, which stores its
+         * elements contiguously instead of allocating a node per element. Its size is reserved up front if the size of this
+         * view is known. Example:
+         * ```cpp
+         * std::vector<std::string> sequence = { "abc", "def", "ada" };
+         * auto someLazyViewIterator = lz::SomeLazyViewIterator(sequence); // value_type = std::string
+         * lz::FlatHashMap<char, std::string> map = someLazyViewIterator.toFlatMap([](const std::string& s) {
+         *      return s[0]; // Return the dict key, first char of the string
+         * }, lz::KeepLast());
+         * // map yields:
+         * // 'a' : "ada"
+         * // 'd' : "def"
+         * ```
+         * @tparam KeySelectorFunc Is automatically deduced.
+         * @tparam DuplicatePolicy Is automatically deduced.
+         * @tparam Hasher The hash function, `std::hash<Key>` is used by default
+         * @tparam KeyEquality Key equality checker. `std::equal_to<Key>` is used by default.
+         * @tparam Allocator Can be used for the allocator of the map. Default is `std::allocator`.
+         * @param keyGen The function that returns the key for the dictionary, and takes a `value_type` as parameter.
+         * @param duplicatePolicy What to do with elements whose key is already in the map: `lz::KeepFirst` (the default),
+         * `lz::KeepLast` or a function that aggregates the current and the next value, e.g. `std::plus<value_type>()`.
+         * @param allocator Optional, can be used for using a custom allocator.
+         * @return A `lz::FlatHashMap<Key, value_type[, Hasher[, KeyEquality[, Allocator]]]>`
+         */
+        template<class KeySelectorFunc,
+            class DuplicatePolicy = KeepFirst,
+            class Hasher = std::hash<KeyType<KeySelectorFunc>>,
+            class KeyEquality = std::equal_to<KeyType<KeySelectorFunc>>,
+            class Allocator = std::allocator<std::pair<const KeyType<KeySelectorFunc>, value_type>>>
+        FlatHashMap<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator>
+        toFlatMap(KeySelectorFunc keyGen, const DuplicatePolicy& duplicatePolicy = DuplicatePolicy(),
+                  const Allocator& allocator = Allocator()) const {
+            FlatHashMap<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator> map(Hasher(), KeyEquality(),
+                                                                                                  allocator);
+            detail::reserve(map, derived().sizeHint());
+            auto insertSegment = [&map, &keyGen, &duplicatePolicy](auto first, const auto last) {
+                for (; first != last; ++first) {
+                    const value_type& value = *first;
+                    map.insertOrMerge(keyGen(value), value, duplicatePolicy);
+                }
+            };
+            visitSegments(begin(), end(), insertSegment);
+            return map;
+        }
+
         /**
          * Function to stream the iterator to an output stream e.g. `std::cout`.
          * @param o The stream object.
          * @param it The iterator to print.
          * @return The stream object by reference.
          */
-        friend std::ostream& operator<<(std::ostream& o, const BasicIteratorView<Iterator>& it) {
+        friend std::ostream& operator<<(std::ostream& o, const BasicIteratorView<Derived, Iterator>& it) {
             return o << it.toString(" ");
         }
 
         /**
          * Converts an iterator to a string, with a given delimiter. Example: lz::range(4).toString() yields 0123, while
-         * lz::range(4).toString(" ") yields 0 1 2 3 4.
+         * lz::range(4).toString(" ") yields 0 1 2 3.
+         * @tparam Allocator The allocator of the string, `std::allocator<char>` by default.
          * @param delimiter The delimiter between the previous value and the next.
+         * @param allocator Optional, can be used for using a custom allocator, e.g. an `lz::ArenaAllocator<char>`.
          * @return The converted iterator in string format.
          */
-        std::string toString(const char* delimiter = "") const {
-            std::string string;
-            for (const value_type& v : *this) {
-#if __has_include(<format>)
-                string += std::format("{}{}", v, delimiter);
-#else
-                string += fmt::format("{}{}", v, delimiter);
-#endif
-            }
+        template<class Allocator = std::allocator<char>>
+        std::basic_string<char, std::char_traits<char>, Allocator>
+        toString(const char* delimiter = "", const Allocator& allocator = Allocator()) const {
+            using String = std::basic_string<char, std::char_traits<char>, Allocator>;
+            String string(allocator);
+            const std::size_t delimiterLength = std::strlen(delimiter);
 
-            const size_t delimiterLength = std::strlen(delimiter);
-            if (!string.empty() && delimiterLength >= 1) {
-                string.erase(string.end() - delimiterLength);
+            // Upper bounds are capped, so that e.g. a filter that removes almost everything does not reserve for every element
+            const std::size_t size = derived().sizeHint().reserveSize();
+            if (size > 0) {
+                string.reserve(size * maxFormattedSize<value_type>() + (size - 1) * delimiterLength);
             }
 
+            ChunkedAppender<String> append(string);
+            joinInto(begin(), end(), append, fmt::string_view(delimiter, delimiterLength));
+            append.flush();
             return string;
         }
     };
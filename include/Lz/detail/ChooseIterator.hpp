@@ -1,7 +1,6 @@
 #pragma once
 
 #include <iterator>
-#include <functional>
 #include <algorithm>
 
 #include "LzTools.hpp"
@@ -12,7 +11,6 @@ namespace lz { namespace detail {
     class ChooseIterator {
         using FunctionParamType = decltype(*std::declval<Iterator>());
         using Pair = FunctionReturnType<Function, FunctionParamType>;
-        using ChooseFunction = std::function<Pair(FunctionParamType)>;
 
     public:
         using iterator_category = std::input_iterator_tag;
@@ -23,15 +21,15 @@ namespace lz { namespace detail {
 
     private:
         Iterator _iterator{};
-        Iterator _end{};
+        SentinelOf<Iterator> _end{};
 
         mutable value_type _current{};
-        const ChooseFunction* _func{};
+        FunctionContainer<Function> _func{};
 
     private:
         void findNext(const size_t offset = 0) {
-            _iterator = std::find_if(std::next(_iterator, offset), _end, [this](const FunctionParamType value) {
-                std::pair<bool, value_type> result = (*_func)(value);
+            _iterator = findIf(std::next(_iterator, offset), _end, [this](const FunctionParamType value) {
+                std::pair<bool, value_type> result = _func(value);
                 if (result.first) {
                     _current = result.second;
                     return true;
@@ -43,9 +41,17 @@ namespace lz { namespace detail {
     public:
         ChooseIterator() = default;
 
-        explicit ChooseIterator(const Iterator begin, const Iterator end, const ChooseFunction* func) :
+        friend SentinelOf<Iterator> sentinelOf(const ChooseIterator& end) {
+            return end._end;
+        }
+
+        friend bool reachedEnd(const ChooseIterator& iterator, const SentinelOf<Iterator>& end) {
+            return reachedEnd(iterator._iterator, end);
+        }
+
+        explicit ChooseIterator(const Iterator begin, const Iterator end, const FunctionContainer<Function>& func) :
             _iterator(begin),
-            _end(end),
+            _end(sentinelOf(end)),
             _func(func) {
             findNext();
         }
@@ -73,8 +79,8 @@ namespace lz { namespace detail {
             return !(*this != other);
         }
 
-        bool operator!=(const ChooseIterator& /*other*/) const {
-            return _iterator != _end;
+        bool operator!=(const ChooseIterator& other) const {
+            return _iterator != other._iterator;
         }
     };
 }}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    /**
+     * The closed form protocol. Iterators of sequences that follow a formula, such as the ones of `lz::range` and
+     * `lz::repeat`, overload `stridedSum(first, count, stride)` as a hidden friend, which is found by argument dependent
+     * lookup. It returns the sum of the `count` elements `first[0], first[stride], first[2 * stride], ...` without visiting
+     * them. Iterators that pick elements of such a sequence at a fixed distance, such as the one of `lz::takeevery`, pass it
+     * on with a larger stride. Views that use the iterators of their source, such as `lz::take` and `lz::slice`, get it for
+     * free.
+     */
+    template<class Iterator, class = void>
+    struct HasStridedSum : std::false_type {
+    };
+
+    template<class Iterator>
+    struct HasStridedSum<Iterator, decltype(void(stridedSum(std::declval<const Iterator&>(), std::size_t(), std::size_t())))> :
+        std::true_type {
+    };
+
+    // The sum of [begin, end) in constant time
+    template<class Iterator>
+    ValueType<Iterator> sumOf(const Iterator begin, const Iterator end, std::true_type /*hasStridedSum*/) {
+        return stridedSum(begin, static_cast<std::size_t>(std::distance(begin, end)), std::size_t(1));
+    }
+
+    template<class Iterator>
+    ValueType<Iterator> sumOf(const Iterator begin, const Iterator end, std::false_type /*hasStridedSum*/) {
+        return std::accumulate(begin, end, ValueType<Iterator>(0));
+    }
+
+    template<class Iterator>
+    ValueType<Iterator> sumOf(const Iterator begin, const Iterator end) {
+        return sumOf(begin, end, HasStridedSum<Iterator>());
+    }
+}}
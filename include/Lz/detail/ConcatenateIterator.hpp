@@ -5,150 +5,32 @@
 #include <iostream>
 #include <tuple>
 
+#include "ForEachChunk.hpp"
+#include "ForEachSegment.hpp"
 #include "LzTools.hpp"
 
 
 namespace lz { namespace detail {
-    template<class Tuple, size_t I, class = void>
-    struct PlusPlus {
-        void operator()(Tuple& iterators, const Tuple& end) const {
-            if (std::get<I>(iterators) != std::get<I>(end)) {
-                ++std::get<I>(iterators);
-            }
-            else {
-                PlusPlus<Tuple, I + 1>()(iterators, end);
-            }
-        }
-    };
-
-    template<class Tuple, size_t I>
-    struct PlusPlus<Tuple, I, typename std::enable_if<I == std::tuple_size<std::decay_t<Tuple>>::value>::type> {
-        void operator()(const Tuple& /*iterators*/, const Tuple& /*end*/) const {
-        }
-    };
-
-    template<class Tuple, size_t I, class = void>
-    struct NotEqual {
-        bool operator()(const Tuple& iterators, const Tuple& end) const {
-            if (std::get<I>(iterators) != std::get<I>(end)) {
-                return std::get<I>(iterators) != std::get<I>(end);
-            }
-            else {
-                return NotEqual<Tuple, I + 1>()(iterators, end);
-            }
-        }
-    };
-
-    template<class Tuple, size_t I>
-    struct NotEqual<Tuple, I, typename std::enable_if<I == std::tuple_size<std::decay_t<Tuple>>::value - 1>::type> {
-        bool operator()(const Tuple& iterators, const Tuple& end) const {
-            return std::get<I>(iterators) != std::get<I>(end);
-        }
-    };
-
-    template<class Tuple, size_t I, class = void>
-    struct Deref {
-        auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
-            if (std::get<I>(iterators) != std::get<I>(end)) {
-                return *std::get<I>(iterators);
-            }
-            else {
-                return Deref<Tuple, I + 1>()(iterators, end);
-            }
-        }
-    };
-
-    template<class Tuple, size_t I>
-    struct Deref<Tuple, I, typename std::enable_if<I == std::tuple_size<std::decay_t<Tuple>>::value - 1>::type> {
-        auto operator()(const Tuple& iterators, const Tuple&) const -> decltype(*std::get<I>(iterators)) {
-            return *std::get<I>(iterators);
-        }
-    };
-
-    template<class Tuple, size_t I>
-    struct MinusMinus {
-        void operator()(Tuple& iterators, Tuple& end) const {
-            if (std::get<I>(iterators) == std::get<I>(end)) {
-                --std::get<I>(iterators);
-            }
-            else {
-                MinusMinus<Tuple, I - 1>()(iterators, end);
-            }
-        }
-    };
-
-    template<class Tuple>
-    struct MinusMinus<Tuple, 0> {
-        void operator()(Tuple& iterators, Tuple&) const {
-            --std::get<0>(iterators);
-        }
-    };
-
-    template<class Tuple, size_t I>
-    struct MinIs {
-        template<class DifferenceType>
-        void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const {
-            auto current = std::get<I>(iterators);
-            auto currentBegin = std::get<I>(begin);
-
-            // Current is begin, move on to next iterator
-            if (current == currentBegin) {
-                MinIs<Tuple, I - 1>()(iterators, begin, end, offset);
-            }
-            else {
-                auto distance = static_cast<DifferenceType>(std::distance(std::get<I>(begin), std::get<I>(end)));
-                if (distance <= offset) {
-                    std::get<I>(iterators) = std::get<I>(begin);
-                    MinIs<Tuple, I - 1>()(iterators, begin, end, distance == 0 ? 1 : offset - distance);
-                }
-                else {
-                    std::get<I>(iterators) = std::prev(std::get<I>(iterators), offset);
-                }
-            }
-        }
-    };
-
-    template<class Tuple>
-    struct MinIs<Tuple, 0> {
-        template<class DifferenceType>
-        void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const  {
-            auto& current = std::get<0>(iterators);
-            auto currentBegin = std::get<0>(begin);
-            auto distance = static_cast<DifferenceType>(std::distance(current, std::get<0>(end)));
-
-            // first iterator is at position begin, and distance bigger than 0
-            if (current == currentBegin && distance > 0) {
-                throw std::out_of_range("cannot access elements before begin");
-            }
-            else {
-                current = std::prev(current, offset);
-            }
-        }
-    };
-
-    template<class Tuple, size_t I, class = void>
-    struct PlusIs {
-        template<class DifferenceType>
-        void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
-            auto& currentIterator = std::get<I>(iterators);
-            auto currentEnd = std::get<I>(end);
-
-            auto distance = static_cast<DifferenceType>(std::distance(currentIterator, currentEnd));
-
-            if (distance > offset) {
-                currentIterator = std::next(currentIterator, offset);
-            }
-            else {
-                currentIterator = currentEnd;
-                PlusIs<Tuple, I + 1>()(iterators, end, offset - distance);
+    /**
+     * Calls `function(std::get<index>(tuples)...)` for an index that is only known at runtime. Only the index is compared,
+     * which compilers turn into a jump table, instead of comparing the iterators of every segment before it.
+     */
+    template<std::size_t I, std::size_t Size, class = void>
+    struct SegmentAt {
+        template<class Function, class... Tuples>
+        static decltype(auto) visit(const std::size_t index, Function&& function, Tuples&... tuples) {
+            if (index == I) {
+                return function(std::get<I>(tuples)...);
             }
+            return SegmentAt<I + 1, Size>::visit(index, function, tuples...);
         }
     };
 
-    template<class Tuple, size_t I>
-    struct PlusIs<Tuple, I, typename std::enable_if<I == std::tuple_size<std::decay_t<Tuple>>::value>::type> {
-        template<class DifferenceType>
-        void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
+    template<std::size_t I, std::size_t Size>
+    struct SegmentAt<I, Size, std::enable_if_t<I == Size - 1>> {
+        template<class Function, class... Tuples>
+        static decltype(auto) visit(const std::size_t /*index*/, Function&& function, Tuples&... tuples) {
+            return function(std::get<I>(tuples)...);
         }
     };
 
@@ -159,6 +41,11 @@ namespace lz { namespace detail {
         IterTuple _iterators{};
         IterTuple _begin{};
         IterTuple _end{};
+        // The segment the current element is in, or SegmentCount if the iterator is at the end. The segments before it are
+        // at their end, the segments after it at their beginning
+        std::size_t _index{};
+
+        static constexpr std::size_t SegmentCount = sizeof...(Iterators);
 
         using FirstTupleIterator = std::iterator_traits<std::decay_t<decltype(std::get<0>(std::declval<IterTuple>()))>>;
 
@@ -170,6 +57,37 @@ namespace lz { namespace detail {
         using iterator_category = std::random_access_iterator_tag;
 
     private:
+        template<class Function, class... Tuples>
+        static decltype(auto) visit(const std::size_t index, Function&& function, Tuples&... tuples) {
+            return SegmentAt<0, SegmentCount>::visit(index, function, tuples...);
+        }
+
+        bool isEmpty(const std::size_t index) const {
+            return visit(index, [](const auto& begin, const auto& end) { return begin == end; }, _begin, _end);
+        }
+
+        void nextSegment() {
+            do {
+                ++_index;
+            } while (_index != SegmentCount && isEmpty(_index));
+        }
+
+        void previousSegment() {
+            do {
+                --_index;
+            } while (isEmpty(_index));
+        }
+
+        bool isAtSegmentBegin() const {
+            return visit(_index, [](const auto& iterator, const auto& begin) { return iterator == begin; }, _iterators, _begin);
+        }
+
+        template<class Function, std::size_t... I>
+        static void visitEachSegment(const IterTuple& from, const IterTuple& to, Function& function, std::index_sequence<I...> /*is*/) {
+            std::initializer_list<int> expand = {(visitSegments(std::get<I>(from), std::get<I>(to), function), 0)...};
+            static_cast<void>(expand);
+        }
+
         template<size_t... I>
         difference_type minus(std::index_sequence<I...>, const ConcatenateIterator& other) const {
             std::initializer_list<difference_type> totals = {
@@ -182,20 +100,43 @@ namespace lz { namespace detail {
             _iterators(iterators),
             _begin(begin),
             _end(end) {
+            while (_index != SegmentCount &&
+                   visit(_index, [](const auto& iterator, const auto& segmentEnd) { return iterator == segmentEnd; }, _iterators, _end)) {
+                ++_index;
+            }
         }
 
         ConcatenateIterator() = default;
 
+        // Calls function(first, last) for every segment, so that algorithms can run one loop per segment with its own iterators
+        template<class Function>
+        friend void forEachSegment(const ConcatenateIterator begin, const ConcatenateIterator end, Function& function) {
+            visitEachSegment(begin._iterators, end._iterators, function, std::index_sequence_for<Iterators...>());
+        }
+
+        // Every segment is visited on its own, so the end checks of the other segments are not done for every element
+        template<class Sink>
+        friend void forEachChunk(const ConcatenateIterator begin, const ConcatenateIterator end, Sink& sink) {
+            auto visitSegment = [&sink](const auto first, const auto last) {
+                visitChunks(first, last, sink);
+            };
+            visitEachSegment(begin._iterators, end._iterators, visitSegment, std::index_sequence_for<Iterators...>());
+        }
+
         reference operator*() const {
-            return Deref<IterTuple, 0>()(_iterators, _end);
+            return visit(_index, [](const auto& iterator) -> reference { return *iterator; }, _iterators);
         }
 
         pointer operator->() const {
-            return &*this;
+            return &**this;
         }
 
         ConcatenateIterator& operator++() {
-            PlusPlus<IterTuple, 0>()(_iterators, _end);
+            visit(_index, [this](auto& iterator, const auto& end) {
+                if (++iterator == end) {
+                    nextSegment();
+                }
+            }, _iterators, _end);
             return *this;
         }
 
@@ -206,23 +147,65 @@ namespace lz { namespace detail {
         }
 
         ConcatenateIterator& operator--() {
-            MinusMinus<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _end);
+            if (_index == SegmentCount || isAtSegmentBegin()) {
+                previousSegment();
+            }
+            visit(_index, [](auto& iterator) { --iterator; }, _iterators);
             return *this;
         }
 
         ConcatenateIterator operator--(int) {
             ConcatenateIterator tmp(*this);
-            ++*this;
+            --*this;
             return tmp;
         }
 
-        ConcatenateIterator& operator+=(const difference_type offset) {
-            PlusIs<IterTuple, 0>()(_iterators, _end, offset);
+        // Whole segments are skipped using their sizes
+        ConcatenateIterator& operator+=(difference_type offset) {
+            if (offset < 0) {
+                return *this -= -offset;
+            }
+
+            while (offset > 0 && _index != SegmentCount) {
+                const difference_type remaining = visit(_index, [](const auto& iterator, const auto& end) {
+                    return static_cast<difference_type>(std::distance(iterator, end));
+                }, _iterators, _end);
+
+                if (offset < remaining) {
+                    visit(_index, [offset](auto& iterator) {
+                        iterator = std::next(iterator, static_cast<DifferenceType<std::decay_t<decltype(iterator)>>>(offset));
+                    }, _iterators);
+                    break;
+                }
+                visit(_index, [](auto& iterator, const auto& end) { iterator = end; }, _iterators, _end);
+                offset -= remaining;
+                nextSegment();
+            }
             return *this;
         }
 
-        ConcatenateIterator& operator-=(const difference_type offset) {
-            MinIs<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end, offset);
+        ConcatenateIterator& operator-=(difference_type offset) {
+            if (offset < 0) {
+                return *this += -offset;
+            }
+
+            while (offset > 0) {
+                if (_index == SegmentCount || isAtSegmentBegin()) {
+                    previousSegment();
+                }
+                const difference_type taken = visit(_index, [](const auto& iterator, const auto& begin) {
+                    return static_cast<difference_type>(std::distance(begin, iterator));
+                }, _iterators, _begin);
+
+                if (offset <= taken) {
+                    visit(_index, [offset](auto& iterator) {
+                        iterator = std::prev(iterator, static_cast<DifferenceType<std::decay_t<decltype(iterator)>>>(offset));
+                    }, _iterators);
+                    break;
+                }
+                visit(_index, [](auto& iterator, const auto& begin) { iterator = begin; }, _iterators, _begin);
+                offset -= taken;
+            }
             return *this;
         }
 
@@ -243,7 +226,11 @@ namespace lz { namespace detail {
         }
 
         bool operator!=(const ConcatenateIterator& other) const {
-            return NotEqual<IterTuple, 0>()(_iterators, other._iterators);
+            if (_index != other._index) {
+                return true;
+            }
+            return _index != SegmentCount &&
+                   visit(_index, [](const auto& lhs, const auto& rhs) { return lhs != rhs; }, _iterators, other._iterators);
         }
 
         bool operator==(const ConcatenateIterator& other) const {
@@ -270,4 +257,4 @@ namespace lz { namespace detail {
             return !(*this < other);
         }
     };
-}}
\ No newline at end of file
+}}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__AVX2__)
+  #define LZ_HAS_AVX2
+  #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define LZ_HAS_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+  #include <intrin.h>
+#endif
+
+
+namespace lz { namespace detail {
+    constexpr std::size_t ScanBlockSize = 64;
+
+    inline std::size_t countTrailingZeros(const std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<std::size_t>(index);
+#else
+        std::size_t count = 0;
+        for (std::uint64_t v = value; (v & 1) == 0; v >>= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    // Returns a mask in which bit i is set if data[i] == c, for i < length. length must not be larger than ScanBlockSize.
+    inline std::uint64_t matchMask(const char* data, const std::size_t length, const char c) {
+#if defined(LZ_HAS_AVX2)
+        if (length == ScanBlockSize) {
+            const __m256i needle = _mm256_set1_epi8(c);
+            const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+            const auto lowMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+            const auto highMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+            return static_cast<std::uint64_t>(lowMask) | (static_cast<std::uint64_t>(highMask) << 32);
+        }
+#elif defined(LZ_HAS_SSE2)
+        if (length == ScanBlockSize) {
+            const __m128i needle = _mm_set1_epi8(c);
+            std::uint64_t mask = 0;
+            for (std::size_t i = 0; i < ScanBlockSize; i += 16) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const auto chunkMask = static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                mask |= static_cast<std::uint64_t>(chunkMask) << i;
+            }
+            return mask;
+        }
+#endif
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < length; i++) {
+            mask |= static_cast<std::uint64_t>(data[i] == c) << i;
+        }
+        return mask;
+    }
+
+    /**
+     * Finds delimiters in a string, one block of `ScanBlockSize` bytes at a time. The block starts at the next occurrence of
+     * the first byte of the delimiter, and the positions within the block where the first two bytes of the delimiter match
+     * are kept in a bit mask, so that finding the next delimiter is usually a matter of popping the lowest bit. The
+     * positions passed to `find` must never decrease.
+     */
+    class DelimiterScanner {
+        std::size_t _blockStart{};
+        std::size_t _blockEnd{};
+        std::uint64_t _mask{};
+
+    public:
+        std::size_t find(const char* data, const std::size_t length, const char* delimiter, const std::size_t delimiterLength,
+                         const std::size_t position) {
+            if (delimiterLength == 0) {
+                return position <= length ? position : std::string::npos;
+            }
+            if (delimiterLength > length) {
+                return std::string::npos;
+            }
+
+            // The last position where the delimiter still fits
+            const std::size_t lastStart = length - delimiterLength;
+
+            while (true) {
+                while (_mask != 0) {
+                    const std::size_t candidate = _blockStart + countTrailingZeros(_mask);
+                    _mask &= _mask - 1;
+
+                    // Candidates that lie before position are discarded, the first two bytes of the others already match
+                    if (candidate >= position &&
+                        (delimiterLength <= 2 ||
+                         std::memcmp(data + candidate + 2, delimiter + 2, delimiterLength - 2) == 0)) {
+                        return candidate;
+                    }
+                }
+
+                std::size_t start = std::max(_blockEnd, position);
+                if (start > lastStart) {
+                    return std::string::npos;
+                }
+
+                // Skip to the first candidate, so that long tokens are passed over at memchr speed
+                const void* first = std::memchr(data + start, delimiter[0], lastStart + 1 - start);
+                if (first == nullptr) {
+                    _blockStart = _blockEnd = length;
+                    _mask = 0;
+                    return std::string::npos;
+                }
+                start = static_cast<std::size_t>(static_cast<const char*>(first) - data);
+
+                // Sparse delimiters are not worth a block: verify the candidate and let memchr find the next one
+                if (start - _blockStart >= ScanBlockSize) {
+                    _blockStart = start;
+                    _blockEnd = start + 1;
+                    _mask = 0;
+                    if (delimiterLength == 1 ||
+                        (data[start + 1] == delimiter[1] &&
+                         std::memcmp(data + start + 2, delimiter + 2, delimiterLength - 2) == 0)) {
+                        return start;
+                    }
+                    continue;
+                }
+
+                const std::size_t blockLength = std::min(ScanBlockSize, lastStart + 1 - start);
+                _blockStart = start;
+                _blockEnd = start + blockLength;
+                _mask = matchMask(data + start, blockLength, delimiter[0]);
+                if (delimiterLength > 1) {
+                    // Only keep the candidates that are followed by the second byte of the delimiter
+                    _mask &= matchMask(data + start + 1, blockLength, delimiter[1]);
+                }
+            }
+        }
+    };
+}}
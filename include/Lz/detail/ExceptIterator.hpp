@@ -3,27 +3,179 @@
 #include <type_traits>
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+#include "FlatHashSet.hpp"
+#include "LzTools.hpp"
 
 
 namespace lz {
-    template<class, class>
+    template<class, class, class>
     class Except;
 
     namespace detail {
-        template<class Iterator, class IteratorToExcept>
+        template<class T, class = void>
+        struct IsHashable : std::false_type {
+        };
+
+        template<class T>
+        struct IsHashable<T, decltype(std::hash<T>()(std::declval<const T&>()), void())> : std::true_type {
+        };
+
+        // Exclusion ranges up to this size are searched linearly, which is faster than hashing for a handful of elements
+        constexpr std::size_t SmallExclusionSize = 8;
+
+        template<class Allocator, class T>
+        using ReboundAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+        // Fallback for types that cannot be hashed: a sorted copy of the exclusion range, probed with a binary search
+        template<class T, class Allocator>
+        class SortedExclusionSet {
+            std::vector<T, ReboundAllocator<Allocator, T>> _values;
+
+        public:
+            explicit SortedExclusionSet(const Allocator& allocator = Allocator()) :
+                _values(ReboundAllocator<Allocator, T>(allocator)) {
+            }
+
+            template<class Iterator>
+            void assign(const Iterator begin, const Iterator end) {
+                _values.assign(begin, end);
+                if (!std::is_sorted(_values.begin(), _values.end())) {
+                    std::sort(_values.begin(), _values.end());
+                }
+            }
+
+            bool contains(const T& value) const {
+                return std::binary_search(_values.begin(), _values.end(), value);
+            }
+        };
+
+        template<class T, class Allocator>
+        class HashedExclusionSet {
+            using Set = FlatHashSet<T, std::hash<T>, std::equal_to<T>, ReboundAllocator<Allocator, T>>;
+
+            std::vector<T, ReboundAllocator<Allocator, T>> _small;
+            Set _hashed;
+            bool _isSmall{true};
+
+        public:
+            explicit HashedExclusionSet(const Allocator& allocator = Allocator()) :
+                _small(ReboundAllocator<Allocator, T>(allocator)),
+                _hashed(std::hash<T>(), std::equal_to<T>(), ReboundAllocator<Allocator, T>(allocator)) {
+            }
+
+            template<class Iterator>
+            void assign(const Iterator begin, const Iterator end) {
+                _small.assign(begin, end);
+                _isSmall = _small.size() <= SmallExclusionSize;
+                _hashed = Set(std::hash<T>(), std::equal_to<T>(), _small.get_allocator());
+                if (_isSmall) {
+                    return;
+                }
+
+                _hashed.reserve(_small.size());
+                for (const T& value : _small) {
+                    _hashed.insert(value);
+                }
+                _small = std::vector<T, ReboundAllocator<Allocator, T>>(_small.get_allocator());
+            }
+
+            bool contains(const T& value) const {
+                if (_isSmall) {
+                    return std::find(_small.begin(), _small.end(), value) != _small.end();
+                }
+                return _hashed.contains(value);
+            }
+        };
+
+        // Integers that lie close together are kept in a bitset over [min, max], anything else in a hash set
+        template<class T, class Allocator>
+        class IntegralExclusionSet {
+            using Unsigned = std::make_unsigned_t<T>;
+            using Word = std::uint64_t;
+
+            static constexpr std::size_t WordBits = std::numeric_limits<Word>::digits;
+            // A bitset may use at most this many words per excluded value, a flat hash set uses about four per value
+            static constexpr std::size_t MaxWordsPerValue = 4;
+
+            std::vector<Word, ReboundAllocator<Allocator, Word>> _bits;
+            Unsigned _min{};
+            Unsigned _span{};
+            HashedExclusionSet<T, Allocator> _hashed;
+            bool _isBitset{};
+
+        public:
+            explicit IntegralExclusionSet(const Allocator& allocator = Allocator()) :
+                _bits(ReboundAllocator<Allocator, Word>(allocator)),
+                _hashed(allocator) {
+            }
+
+            template<class Iterator>
+            void assign(const Iterator begin, const Iterator end) {
+                std::vector<T, ReboundAllocator<Allocator, T>> values(begin, end, ReboundAllocator<Allocator, T>(_bits.get_allocator()));
+                _bits.clear();
+                _isBitset = false;
+
+                if (values.size() > SmallExclusionSize) {
+                    const auto minMax = std::minmax_element(values.begin(), values.end());
+                    _min = static_cast<Unsigned>(*minMax.first);
+                    _span = static_cast<Unsigned>(static_cast<Unsigned>(*minMax.second) - _min);
+                    _isBitset = _span / WordBits < values.size() * MaxWordsPerValue;
+                }
+
+                if (!_isBitset) {
+                    _hashed.assign(values.begin(), values.end());
+                    return;
+                }
+
+                _bits.assign(static_cast<std::size_t>(_span / WordBits) + 1, 0);
+                for (const T value : values) {
+                    const auto offset = static_cast<std::size_t>(static_cast<Unsigned>(static_cast<Unsigned>(value) - _min));
+                    _bits[offset / WordBits] |= Word(1) << (offset % WordBits);
+                }
+            }
+
+            bool contains(const T value) const {
+                if (!_isBitset) {
+                    return _hashed.contains(value);
+                }
+                const auto offset = static_cast<Unsigned>(static_cast<Unsigned>(value) - _min);
+                if (offset > _span) {
+                    return false;
+                }
+                return (_bits[static_cast<std::size_t>(offset / WordBits)] >> (offset % WordBits)) & 1;
+            }
+        };
+
+        template<class T, class Allocator>
+        using ExclusionSet = std::conditional_t<std::is_integral<T>::value && !std::is_same<T, bool>::value,
+            IntegralExclusionSet<T, Allocator>,
+            std::conditional_t<IsHashable<T>::value, HashedExclusionSet<T, Allocator>, SortedExclusionSet<T, Allocator>>>;
+
+        template<class Iterator, class IteratorToExcept, class Allocator>
         struct ExceptIteratorHelper {
-            IteratorToExcept toExceptBegin{};
-            IteratorToExcept toExceptEnd{};
-            Iterator end{};
-            bool isSorted{};
+            SentinelOf<Iterator> end{};
+            ExclusionSet<ValueType<IteratorToExcept>, Allocator> exclusionSet{};
+
+            ExceptIteratorHelper() = default;
+
+            ExceptIteratorHelper(const Iterator& end, const Allocator& allocator) :
+                end(sentinelOf(end)),
+                exclusionSet(allocator) {
+            }
         };
 
-        template<class Iterator, class IteratorToExcept>
+        template<class Iterator, class IteratorToExcept, class Allocator>
         class ExceptIterator {
             using IterTraits = std::iterator_traits<Iterator>;
-            using ValueTypeToExcept = typename std::iterator_traits<IteratorToExcept>::value_type;
+
         public:
-            using iterator_category = std::forward_iterator_tag;
+            using iterator_category = std::conditional_t<
+                std::is_convertible<typename IterTraits::iterator_category, std::forward_iterator_tag>::value,
+                std::forward_iterator_tag, std::input_iterator_tag>;
             using value_type = typename IterTraits::value_type;
             using difference_type = typename IterTraits::difference_type;
             using pointer = typename IterTraits::pointer;
@@ -31,29 +183,32 @@ namespace lz {
 
         private:
             Iterator _iterator{};
-            const ExceptIteratorHelper<Iterator, IteratorToExcept>* _iteratorHelper{};
+            const ExceptIteratorHelper<Iterator, IteratorToExcept, Allocator>* _iteratorHelper{};
 
-            friend class Except<Iterator, IteratorToExcept>;
+            friend class Except<Iterator, IteratorToExcept, Allocator>;
 
             void find() {
-                _iterator = std::find_if(_iterator, _iteratorHelper->end, [this](const value_type& value) {
-                    return !std::binary_search(_iteratorHelper->toExceptBegin, _iteratorHelper->toExceptEnd, value);
+                const auto& exclusionSet = _iteratorHelper->exclusionSet;
+                _iterator = findIf(_iterator, _iteratorHelper->end, [&exclusionSet](reference value) {
+                    return !exclusionSet.contains(value);
                 });
             }
 
         public:
             ExceptIterator() = default;
 
-            explicit ExceptIterator(const Iterator begin, const Iterator end,
-                                    const ExceptIteratorHelper<Iterator, IteratorToExcept>* iteratorHelper) :
+            friend SentinelOf<Iterator> sentinelOf(const ExceptIterator& end) {
+                return end._iteratorHelper->end;
+            }
+
+            friend bool reachedEnd(const ExceptIterator& iterator, const SentinelOf<Iterator>& end) {
+                return reachedEnd(iterator._iterator, end);
+            }
+
+            explicit ExceptIterator(const Iterator begin, const ExceptIteratorHelper<Iterator, IteratorToExcept, Allocator>* iteratorHelper) :
                 _iterator(begin),
                 _iteratorHelper(iteratorHelper) {
-                if (begin != end) {
-                    if (!_iteratorHelper->isSorted) {
-                        std::sort(begin, end);
-                    }
-                    find();
-                }
+                find();
             }
 
             reference operator*() const {
@@ -66,9 +221,7 @@ namespace lz {
 
             ExceptIterator& operator++() {
                 ++_iterator;
-                if (_iterator != _iteratorHelper->end) {
-                    find();
-                }
+                find();
                 return *this;
             }
 
@@ -79,7 +232,7 @@ namespace lz {
             }
 
             bool operator!=(const ExceptIterator& other) const {
-                return _iterator != other._iteratorHelper->end;
+                return _iterator != other._iterator;
             }
 
             bool operator==(const ExceptIterator& other) const {
@@ -87,4 +240,4 @@ namespace lz {
             }
         };
     }
-}
\ No newline at end of file
+}
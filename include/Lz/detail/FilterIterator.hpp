@@ -2,7 +2,9 @@
 
 #include <type_traits>
 #include <algorithm>
-#include <functional>
+
+#include "ForEachChunk.hpp"
+#include "LzTools.hpp"
 
 
 namespace lz { namespace detail {
@@ -14,35 +16,120 @@ namespace lz { namespace detail {
         using iterator_category = std::forward_iterator_tag;
         using value_type = typename IterTraits::value_type;
         using difference_type = typename IterTraits::difference_type;
-        using pointer = typename IterTraits::pointer;
         using reference = typename IterTraits::reference;
+        using pointer = std::conditional_t<IsComputed<Iterator>::value, FakePointerProxy<reference>, typename IterTraits::pointer>;
 
     private:
+        struct NoValue {
+        };
+
+        // The computed value that satisfied the predicate, e.g. of a Map, so that it is computed once instead of twice
+        using Cache = std::conditional_t<IsComputed<Iterator>::value, CachedValue<std::remove_cv_t<reference>>, NoValue>;
+
         Iterator _iterator{};
-        Iterator _end{};
-        const std::function<bool(value_type)>* _predicate{};
+        SentinelOf<Iterator> _end{};
+        FunctionContainer<Function> _predicate{};
+        Cache _cache{};
+
+        void find(std::false_type /*isComputed*/) {
+            _iterator = findIf(_iterator, _end, [this](reference value) {
+                return _predicate(value);
+            });
+        }
+
+        void find(std::true_type /*isComputed*/) {
+            for (; !reachedEnd(_iterator, _end); ++_iterator) {
+                _cache.emplace(*_iterator);
+                if (_predicate(_cache.get())) {
+                    return;
+                }
+            }
+            _cache.reset();
+        }
+
+        void find() {
+            find(IsComputed<Iterator>());
+        }
+
+        reference dereference(std::false_type /*isComputed*/) const {
+            return *_iterator;
+        }
+
+        reference dereference(std::true_type /*isComputed*/) const {
+            return _cache.get();
+        }
+
+        pointer arrow(std::false_type /*isComputed*/) const {
+            return &*_iterator;
+        }
+
+        pointer arrow(std::true_type /*isComputed*/) const {
+            return FakePointerProxy<reference>(_cache.get());
+        }
 
     public:
-        FilterIterator(const Iterator begin, const Iterator end, const std::function<bool(value_type)>* function) :
+        FilterIterator(const Iterator begin, const Iterator end, const FunctionContainer<Function>& function) :
             _iterator(begin),
-            _end(end),
+            _end(sentinelOf(end)),
             _predicate(function) {
-            _iterator = std::find_if(_iterator, _end, *_predicate);
+            find();
         }
 
         FilterIterator() = default;
 
+        // A filter iterator is at its end when its underlying iterator is, so its end is the end of that iterator
+        friend SentinelOf<Iterator> sentinelOf(const FilterIterator& end) {
+            return end._end;
+        }
+
+        friend bool reachedEnd(const FilterIterator& iterator, const SentinelOf<Iterator>& end) {
+            return reachedEnd(iterator._iterator, end);
+        }
+
+        // The values of every chunk of the underlying sequence that satisfy the predicate are gathered in one tight loop
+        template<class Sink, class V = value_type, std::enable_if_t<IsBufferable<V>::value &&
+            IsInvocable<const FunctionContainer<Function>&, const V&>::value, int> = 0>
+        friend void forEachChunk(const FilterIterator begin, const FilterIterator end, Sink& sink) {
+            constexpr std::size_t chunkSize = chunkSizeOf<value_type>();
+            value_type buffer[chunkSize];
+            const FunctionContainer<Function>& predicate = begin._predicate;
+
+            auto filterChunk = [&](const auto* data, std::size_t count) {
+                while (count > 0) {
+                    const std::size_t filtered = count < chunkSize ? count : chunkSize;
+                    std::size_t kept = 0;
+                    for (std::size_t i = 0; i < filtered; i++) {
+                        // Cheap values are always copied and only kept if they match, which needs no branch
+                        if (std::is_trivially_copyable<value_type>::value) {
+                            buffer[kept] = data[i];
+                            kept += static_cast<std::size_t>(static_cast<bool>(predicate(data[i])));
+                        }
+                        else if (predicate(data[i])) {
+                            buffer[kept++] = data[i];
+                        }
+                    }
+                    if (kept > 0) {
+                        sink(static_cast<const value_type*>(buffer), kept);
+                    }
+                    data += filtered;
+                    count -= filtered;
+                }
+            };
+            visitChunks(begin._iterator, end._iterator, filterChunk);
+        }
+
         reference operator*() const {
-            return *_iterator;
+            return dereference(IsComputed<Iterator>());
         }
 
         pointer operator->() const {
-            return &*_iterator;
+            return arrow(IsComputed<Iterator>());
         }
 
         FilterIterator& operator++() {
-            if (_iterator != _end) {
-                _iterator = std::find_if(++_iterator, _end, *_predicate);
+            if (!reachedEnd(_iterator, _end)) {
+                ++_iterator;
+                find();
             }
             return *this;
         }
@@ -54,7 +141,7 @@ namespace lz { namespace detail {
         }
 
         bool operator!=(const FilterIterator& other) const {
-            return _iterator != other._end;
+            return _iterator != other._iterator;
         }
 
         bool operator==(const FilterIterator& other) const {
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "FlatHashSet.hpp"
+
+
+namespace lz {
+    namespace detail {
+        struct FirstOf {
+            template<class Pair>
+            const typename Pair::first_type& operator()(const Pair& pair) const {
+                return pair.first;
+            }
+        };
+    }
+
+    /**
+     * Duplicate policy of `toFlatMap`: the first element with a key is kept.
+     */
+    struct KeepFirst {
+        template<class T>
+        const T& operator()(const T& first, const T& /*next*/) const {
+            return first;
+        }
+    };
+
+    /**
+     * Duplicate policy of `toFlatMap`: the last element with a key is kept.
+     */
+    struct KeepLast {
+        template<class T>
+        const T& operator()(const T& /*previous*/, const T& last) const {
+            return last;
+        }
+    };
+
+    /**
+     * Hash map that stores its elements contiguously, in insertion order, and finds them using an open addressing table of
+     * hashes and indices. Compared to `std::unordered_map` it does not allocate a node per element, so building and
+     * iterating over it is a lot faster, but elements cannot be erased. Inserting may invalidate references and iterators
+     * to elements, like `std::vector`.
+     * @tparam Key The key type.
+     * @tparam T The mapped type.
+     * @tparam Hash The hash function, `std::hash<Key>` is used by default.
+     * @tparam KeyEqual Key equality checker. `std::equal_to<Key>` is used by default.
+     * @tparam Allocator Is rebound to allocate the elements and the table.
+     */
+    template<class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+        class Allocator = std::allocator<std::pair<const Key, T>>>
+    class FlatHashMap : public detail::FlatHashTable<std::pair<const Key, T>, Key, detail::FirstOf, Hash, KeyEqual, Allocator> {
+        using Base = detail::FlatHashTable<std::pair<const Key, T>, Key, detail::FirstOf, Hash, KeyEqual, Allocator>;
+        using Values = std::vector<std::pair<const Key, T>,
+            typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const Key, T>>>;
+
+        template<class Function>
+        void merge(T& /*current*/, const T& /*next*/, const Function& /*duplicatePolicy*/, std::true_type /*keepFirst*/) {
+        }
+
+        template<class Function>
+        void merge(T& current, const T& next, const Function& duplicatePolicy, std::false_type /*keepFirst*/) {
+            current = duplicatePolicy(current, next);
+        }
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const Key, T>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+        using iterator = typename Values::iterator;
+        using const_iterator = typename Values::const_iterator;
+
+        using Base::Base;
+
+        FlatHashMap() = default;
+
+        FlatHashMap(const FlatHashMap&) = default;
+
+        FlatHashMap(FlatHashMap&&) = default;
+
+        // The keys of the elements are const, so the elements cannot be assigned to. Copy and swap instead.
+        FlatHashMap& operator=(const FlatHashMap& other) {
+            FlatHashMap copy(other);
+            this->swap(copy);
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+            this->swap(other);
+            return *this;
+        }
+
+        iterator begin() {
+            return this->_values.begin();
+        }
+
+        iterator end() {
+            return this->_values.end();
+        }
+
+        const_iterator begin() const {
+            return this->_values.begin();
+        }
+
+        const_iterator end() const {
+            return this->_values.end();
+        }
+
+        /**
+         * @brief Returns a pointer to the elements, which are stored contiguously in insertion order.
+         */
+        const value_type* data() const {
+            return this->_values.data();
+        }
+
+        iterator find(const Key& key) {
+            return begin() + static_cast<std::ptrdiff_t>(this->indexOf(key));
+        }
+
+        const_iterator find(const Key& key) const {
+            return begin() + static_cast<std::ptrdiff_t>(this->indexOf(key));
+        }
+
+        size_type count(const Key& key) const {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        const T& at(const Key& key) const {
+            const_iterator it = find(key);
+            if (it == end()) {
+                throw std::out_of_range("line " + std::to_string(__LINE__) + ": " + __FILE__ + " key not found");
+            }
+            return it->second;
+        }
+
+        T& at(const Key& key) {
+            return const_cast<T&>(static_cast<const FlatHashMap&>(*this).at(key));
+        }
+
+        /**
+         * @brief Returns the value of `key`, inserting a value initialized one if the map does not contain the key yet.
+         */
+        T& operator[](const Key& key) {
+            return tryEmplace(key).first->second;
+        }
+
+        /**
+         * @brief Constructs the value of `key` from `args` if the map does not contain `key` yet. Otherwise, `args` are not
+         * used.
+         * @return An iterator to the element with `key` and `true` if it was inserted.
+         */
+        template<class... Args>
+        std::pair<iterator, bool> tryEmplace(const Key& key, Args&& ... args) {
+            const std::pair<std::size_t, bool> result = this->emplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                                                      std::forward_as_tuple(std::forward<Args>(args)...));
+            return {begin() + static_cast<std::ptrdiff_t>(result.first), result.second};
+        }
+
+        /**
+         * @brief Inserts `value` if the map does not contain its key yet.
+         * @return An iterator to the element with the key of `value` and `true` if `value` was inserted.
+         */
+        std::pair<iterator, bool> insert(const value_type& value) {
+            const std::pair<std::size_t, bool> result = this->emplace(value.first, value);
+            return {begin() + static_cast<std::ptrdiff_t>(result.first), result.second};
+        }
+
+        /**
+         * @brief Inserts `key` with `value`. If the map already contains `key`, its value becomes
+         * `duplicatePolicy(currentValue, value)`.
+         * @param duplicatePolicy `lz::KeepFirst`, `lz::KeepLast` or a function that combines two values, e.g.
+         * `std::plus<T>()`.
+         */
+        template<class DuplicatePolicy>
+        void insertOrMerge(const Key& key, const T& value, const DuplicatePolicy& duplicatePolicy) {
+            const std::pair<std::size_t, bool> result = this->emplace(key, key, value);
+            if (!result.second) {
+                merge(this->_values[result.first].second, value, duplicatePolicy, std::is_same<DuplicatePolicy, KeepFirst>());
+            }
+        }
+
+        friend bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs) {
+            if (lhs.size() != rhs.size()) {
+                return false;
+            }
+            for (const value_type& value : lhs) {
+                const const_iterator it = rhs.find(value.first);
+                if (it == rhs.end() || !(it->second == value.second)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        friend bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs) {
+            return !(lhs == rhs);
+        }
+    };
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace lz { namespace detail {
+    /**
+     * Open addressing hash table with linear probing. The values are stored contiguously in insertion order and the table
+     * only holds their hashes and indices, so probing touches a single small array and growing the table never moves a
+     * value. Values cannot be erased. `KeyOf` returns the key of a value.
+     */
+    template<class Value, class Key, class KeyOf, class Hash, class KeyEqual, class Allocator>
+    class FlatHashTable {
+        struct Bucket {
+            std::size_t hash;
+            // Index of the value + 1, 0 means that the bucket is empty
+            std::size_t index;
+        };
+
+        using ValueAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Value>;
+        using BucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>;
+
+    protected:
+        std::vector<Value, ValueAllocator> _values;
+
+    private:
+        std::vector<Bucket, BucketAllocator> _buckets;
+        Hash _hash{};
+        KeyEqual _keyEqual{};
+
+        static constexpr std::size_t MinBucketCount = 16;
+
+        // std::hash is the identity function for integers on most implementations, which would place runs of numbers in
+        // one cluster. Spread the bits over the whole word before they are masked.
+        std::size_t hashOf(const Key& key) const {
+            const std::size_t hash = static_cast<std::size_t>(_hash(key)) * static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+            return hash ^ (hash >> (sizeof(std::size_t) * 4));
+        }
+
+        // The table is kept at most half full, so that probe sequences stay short
+        static std::size_t bucketCountFor(const std::size_t size) {
+            std::size_t count = MinBucketCount;
+            while (count < size * 2) {
+                count *= 2;
+            }
+            return count;
+        }
+
+        void rehash(const std::size_t bucketCount) {
+            std::vector<Bucket, BucketAllocator> buckets(bucketCount, Bucket{0, 0}, _buckets.get_allocator());
+            const std::size_t mask = bucketCount - 1;
+
+            for (const Bucket& bucket : _buckets) {
+                if (bucket.index == 0) {
+                    continue;
+                }
+                std::size_t position = bucket.hash & mask;
+                while (buckets[position].index != 0) {
+                    position = (position + 1) & mask;
+                }
+                buckets[position] = bucket;
+            }
+            _buckets = std::move(buckets);
+        }
+
+        // Returns the bucket that contains key, or the empty bucket where it should be inserted
+        std::size_t findBucket(const Key& key, const std::size_t hash) const {
+            const std::size_t mask = _buckets.size() - 1;
+            std::size_t position = hash & mask;
+
+            while (true) {
+                const Bucket& bucket = _buckets[position];
+                if (bucket.index == 0 || (bucket.hash == hash && _keyEqual(KeyOf()(_values[bucket.index - 1]), key))) {
+                    return position;
+                }
+                position = (position + 1) & mask;
+            }
+        }
+
+    protected:
+        // Returns the index of the value with `key`, or the size of the table if there is none
+        std::size_t indexOf(const Key& key) const {
+            if (_buckets.empty()) {
+                return _values.size();
+            }
+            const Bucket& bucket = _buckets[findBucket(key, hashOf(key))];
+            return bucket.index == 0 ? _values.size() : bucket.index - 1;
+        }
+
+        /**
+         * Constructs a value from `args` if the table does not contain a value with `key` yet.
+         * @return The index of the value with `key` and `true` if it was inserted.
+         */
+        template<class... Args>
+        std::pair<std::size_t, bool> emplace(const Key& key, Args&& ... args) {
+            if ((_values.size() + 1) * 2 > _buckets.size()) {
+                rehash(bucketCountFor(_values.size() + 1));
+            }
+
+            const std::size_t hash = hashOf(key);
+            Bucket& bucket = _buckets[findBucket(key, hash)];
+            if (bucket.index != 0) {
+                return {bucket.index - 1, false};
+            }
+
+            _values.emplace_back(std::forward<Args>(args)...);
+            bucket = Bucket{hash, _values.size()};
+            return {_values.size() - 1, true};
+        }
+
+    public:
+        explicit FlatHashTable(Hash hash = Hash(), KeyEqual keyEqual = KeyEqual(), const Allocator& allocator = Allocator()) :
+            _values(ValueAllocator(allocator)),
+            _buckets(BucketAllocator(allocator)),
+            _hash(std::move(hash)),
+            _keyEqual(std::move(keyEqual)) {
+        }
+
+        void swap(FlatHashTable& other) noexcept {
+            using std::swap;
+            _values.swap(other._values);
+            _buckets.swap(other._buckets);
+            swap(_hash, other._hash);
+            swap(_keyEqual, other._keyEqual);
+        }
+
+        void reserve(const std::size_t size) {
+            _values.reserve(size);
+            const std::size_t bucketCount = bucketCountFor(size);
+            if (bucketCount > _buckets.size()) {
+                rehash(bucketCount);
+            }
+        }
+
+        bool contains(const Key& key) const {
+            return indexOf(key) != _values.size();
+        }
+
+        std::size_t size() const {
+            return _values.size();
+        }
+
+        bool empty() const {
+            return _values.empty();
+        }
+    };
+
+    struct Identity {
+        template<class T>
+        const T& operator()(const T& value) const {
+            return value;
+        }
+    };
+
+    template<class T, class Hash, class KeyEqual, class Allocator>
+    class FlatHashSet : public FlatHashTable<T, T, Identity, Hash, KeyEqual, Allocator> {
+        using Base = FlatHashTable<T, T, Identity, Hash, KeyEqual, Allocator>;
+
+    public:
+        using Base::Base;
+
+        FlatHashSet() = default;
+
+        /**
+         * Inserts `value` if the set does not contain an equal value yet.
+         * @return `true` if `value` was inserted, `false` if the set already contained it.
+         */
+        bool insert(const T& value) {
+            return this->emplace(value, value).second;
+        }
+    };
+}}
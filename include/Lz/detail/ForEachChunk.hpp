@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    // A chunk buffer takes up about this many bytes, so that it fits in the L1 cache together with its source
+    constexpr std::size_t ChunkBytes = 2048;
+
+    template<class T>
+    constexpr std::size_t chunkSizeOf() {
+        return sizeof(T) >= ChunkBytes ? 1 : ChunkBytes / sizeof(T);
+    }
+
+    // Chunks of values that are not stored anywhere are written to a buffer of this type
+    template<class T>
+    struct IsBufferable : std::integral_constant<bool, std::is_object<T>::value && std::is_default_constructible<T>::value &&
+                                                       std::is_copy_assignable<T>::value> {
+    };
+
+    template<class Function, class Arg, class = void>
+    struct IsInvocable : std::false_type {
+    };
+
+    template<class Function, class Arg>
+    struct IsInvocable<Function, Arg, decltype(std::declval<Function>()(std::declval<Arg>()), void())> : std::true_type {
+    };
+
+    /**
+     * The chunked iteration protocol. `sink(const value_type* data, std::size_t count)` is called for consecutive chunks of
+     * [begin, end), with `count > 0`. Iterators that can do better than one element at a time overload this function as a
+     * hidden friend, which is found by argument dependent lookup. This is the fallback for all other iterators: contiguous
+     * ranges are passed as a whole, anything else is copied to a buffer first.
+     */
+    template<class Iterator, class Sink, class Bufferable>
+    void forEachChunk(const Iterator begin, const Iterator end, Sink& sink, std::true_type /*isContiguous*/, Bufferable) {
+        if (begin != end) {
+            sink(static_cast<const ValueType<Iterator>*>(std::addressof(*begin)), static_cast<std::size_t>(end - begin));
+        }
+    }
+
+    template<class Iterator, class Sink>
+    void forEachChunk(Iterator begin, const Iterator end, Sink& sink, std::false_type /*isContiguous*/,
+                      std::true_type /*isBufferable*/) {
+        using T = ValueType<Iterator>;
+        constexpr std::size_t chunkSize = chunkSizeOf<T>();
+        T buffer[chunkSize];
+
+        while (begin != end) {
+            std::size_t count = 0;
+            for (; count < chunkSize && begin != end; ++begin, ++count) {
+                buffer[count] = *begin;
+            }
+            sink(static_cast<const T*>(buffer), count);
+        }
+    }
+
+    template<class Iterator, class Sink>
+    void forEachChunk(Iterator begin, const Iterator end, Sink& sink, std::false_type /*isContiguous*/,
+                      std::false_type /*isBufferable*/) {
+        for (; begin != end; ++begin) {
+            const ValueType<Iterator> value = *begin;
+            sink(std::addressof(value), std::size_t(1));
+        }
+    }
+
+    template<class Iterator, class Sink>
+    void forEachChunk(const Iterator begin, const Iterator end, Sink& sink) {
+        forEachChunk(begin, end, sink, IsContiguous<Iterator>(), IsBufferable<ValueType<Iterator>>());
+    }
+
+    // Entry point of the protocol, so that the overloads of forEachChunk are looked up from one place
+    template<class Iterator, class Sink>
+    void visitChunks(const Iterator begin, const Iterator end, Sink& sink) {
+        forEachChunk(begin, end, sink);
+    }
+}}
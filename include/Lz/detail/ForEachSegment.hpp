@@ -0,0 +1,21 @@
+#pragma once
+
+
+namespace lz { namespace detail {
+    /**
+     * The segmented iteration protocol. `function(first, last)` is called for consecutive segments that together form
+     * [begin, end). Iterators that are made of several ranges, such as the one of `lz::concat`, overload this function as a
+     * hidden friend, which is found by argument dependent lookup, so that algorithms can run a tight loop over the iterators
+     * of every range instead of going through the combined iterator for every element. All other iterators are one segment.
+     */
+    template<class Iterator, class Function>
+    void forEachSegment(const Iterator begin, const Iterator end, Function& function) {
+        function(begin, end);
+    }
+
+    // Entry point of the protocol, so that the overloads of forEachSegment are looked up from one place
+    template<class Iterator, class Function>
+    void visitSegments(const Iterator begin, const Iterator end, Function& function) {
+        forEachSegment(begin, end, function);
+    }
+}}
@@ -3,13 +3,12 @@
 #include "LzTools.hpp"
 
 #include <iterator>
-#include <functional>
 
 
 namespace lz { namespace detail {
-    template<class GeneratorFunc, class ValueType>
+    template<class GeneratorFunc>
     struct GenerateIteratorHelper {
-        std::function<ValueType()> generator{};
+        FunctionContainer<GeneratorFunc> generator{};
         bool isWhileTrueLoop{};
     };
 
@@ -24,12 +23,12 @@ namespace lz { namespace detail {
 
     private:
         size_t _current{};
-        const GenerateIteratorHelper<GeneratorFunc, value_type>* _iterHelper{};
+        const GenerateIteratorHelper<GeneratorFunc>* _iterHelper{};
 
     public:
         GenerateIterator() = default;
 
-        GenerateIterator(const size_t start, const GenerateIteratorHelper<GeneratorFunc, value_type>* helper):
+        GenerateIterator(const size_t start, const GenerateIteratorHelper<GeneratorFunc>* helper):
             _current(start),
             _iterHelper(helper)
         {}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "LzTools.hpp"
+#include "../Take.hpp"
+
+
+namespace lz { namespace detail {
+    template<class Iterator, class KeySelector>
+    class GroupByIterator {
+        using IterTraits = std::iterator_traits<Iterator>;
+        using Key = std::decay_t<FunctionReturnType<KeySelector, typename IterTraits::reference>>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<Key, Take<Iterator>>;
+        using difference_type = typename IterTraits::difference_type;
+        using reference = value_type;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        Iterator _groupBegin{};
+        Iterator _groupEnd{};
+        Iterator _end{};
+        std::size_t _groupSize{};
+        Key _key{};
+        FunctionContainer<KeySelector> _keySelector{};
+
+        // A group ends at the first element with a different key, so only the current group is kept
+        void findGroupEnd() {
+            _groupSize = 0;
+            if (_groupEnd == _end) {
+                return;
+            }
+
+            _key = _keySelector(*_groupEnd);
+            do {
+                ++_groupEnd;
+                ++_groupSize;
+            } while (_groupEnd != _end && _keySelector(*_groupEnd) == _key);
+        }
+
+    public:
+        GroupByIterator(const Iterator iterator, const Iterator end, const FunctionContainer<KeySelector>& keySelector) :
+            _groupBegin(iterator),
+            _groupEnd(iterator),
+            _end(end),
+            _keySelector(keySelector) {
+            findGroupEnd();
+        }
+
+        GroupByIterator() = default;
+
+        reference operator*() const {
+            return reference(_key, Take<Iterator>(_groupBegin, _groupEnd, _groupSize));
+        }
+
+        pointer operator->() const {
+            return FakePointerProxy<decltype(**this)>(**this);
+        }
+
+        GroupByIterator& operator++() {
+            _groupBegin = _groupEnd;
+            findGroupEnd();
+            return *this;
+        }
+
+        GroupByIterator operator++(int) {
+            GroupByIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator!=(const GroupByIterator& other) const {
+            return _groupBegin != other._groupBegin;
+        }
+
+        bool operator==(const GroupByIterator& other) const {
+            return !(*this != other);
+        }
+    };
+}}
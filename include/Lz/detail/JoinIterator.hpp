@@ -1,14 +1,17 @@
 #pragma once
 
+ #include <cstring>
  #include <iterator>
+ #include <limits>
+ #include <string>
  #include "LzTools.hpp"
+ #include "../StringView.hpp"
 
 
  #if __has_include(<format>)
    #include <format>
- #else
-   #include <fmt/format.h>
  #endif
+ #include <fmt/format.h>
 
 
  namespace lz { namespace detail {
@@ -26,6 +29,91 @@
      };
 
 
+     // Appends the text of value by calling out(const char* data, std::size_t size), without a std::string per value
+     template<class Appender, class T>
+     void appendFormatted(Appender& out, const T& value, std::true_type /*isFmtIntCompatible*/) {
+         const fmt::format_int formatted(value);
+         out(formatted.data(), formatted.size());
+     }
+
+     template<class Appender, class T>
+     void appendFormatted(Appender& out, const T& value, std::false_type /*isFmtIntCompatible*/) {
+         fmt::memory_buffer buffer;
+         fmt::format_to(std::back_inserter(buffer), "{}", value);
+         out(buffer.data(), buffer.size());
+     }
+
+     template<class Appender, class Traits, class Allocator>
+     void appendFormatted(Appender& out, const std::basic_string<char, Traits, Allocator>& value, std::false_type /*isFmtIntCompatible*/) {
+         out(value.data(), value.size());
+     }
+
+     template<class Appender>
+     void appendFormatted(Appender& out, const StringView value, std::false_type /*isFmtIntCompatible*/) {
+         out(value.data(), value.size());
+     }
+
+     template<class Appender>
+     void appendFormatted(Appender& out, const char value, std::false_type /*isFmtIntCompatible*/) {
+         out(&value, 1);
+     }
+
+     template<class Appender, class T>
+     void appendFormatted(Appender& out, const T& value) {
+         appendFormatted(out, value, IsFmtIntCompatible<T>());
+     }
+
+     // The longest text appendFormatted writes for a T, or 0 if it is unknown. Only used to reserve storage.
+     template<class T>
+     constexpr std::size_t maxFormattedSize() {
+         // Integers: digits, sign and the digit that digits10 leaves out. Floats: shortest digits, sign, point and exponent.
+         return std::is_same<T, bool>::value ? 5 :
+                std::is_integral<T>::value ? std::size_t(std::numeric_limits<T>::digits10) + 2 :
+                std::is_floating_point<T>::value ? std::size_t(std::numeric_limits<T>::max_digits10) + 7 : 0;
+     }
+
+     // Appending many small pieces to a std::string one by one is slow, so they are gathered on the stack first
+     template<class String>
+     class ChunkedAppender {
+         String& _out;
+         char _chunk[256];
+         std::size_t _used{};
+
+     public:
+         explicit ChunkedAppender(String& out) :
+             _out(out) {
+         }
+
+         void operator()(const char* data, const std::size_t size) {
+             if (_used + size > sizeof _chunk) {
+                 flush();
+                 if (size > sizeof _chunk) {
+                     _out.append(data, size);
+                     return;
+                 }
+             }
+             std::memcpy(_chunk + _used, data, size);
+             _used += size;
+         }
+
+         void flush() {
+             _out.append(_chunk, _used);
+             _used = 0;
+         }
+     };
+
+     template<class Iterator, class Appender>
+     void joinInto(Iterator begin, const Iterator end, Appender& out, const fmt::string_view delimiter) {
+         if (begin == end) {
+             return;
+         }
+         appendFormatted(out, *begin);
+         for (++begin; begin != end; ++begin) {
+             out(delimiter.data(), delimiter.size());
+             appendFormatted(out, *begin);
+         }
+     }
+
      template<class Iterator>
      class JoinIterator {
          using IterTraits = std::iterator_traits<Iterator>;
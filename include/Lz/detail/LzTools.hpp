@@ -1,7 +1,15 @@
 #pragma once
 
 
+#include <algorithm>
 #include <utility>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
 
 
 #if __cplusplus < 201703L || (defined(_MSVC_LANG) && _MSVC_LANG < 201703L)
@@ -31,8 +39,399 @@ namespace lz { namespace detail {
     template<class Function, class... Args>
     using FunctionReturnType = decltype(std::declval<Function>()(std::declval<Args>()...));
 
+    template<class Iterator>
+    using ValueType = typename std::iterator_traits<Iterator>::value_type;
+
+    template<class Iterator>
+    using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+
+    template<class Iterable>
+    using ValueTypeIterable = typename std::iterator_traits<decltype(std::begin(std::declval<Iterable>()))>::value_type;
+
+    // Stateless lambdas are empty and trivially copyable, but before C++20 not default constructible nor assignable
+    template<class Function>
+    struct IsEmptyBaseCandidate : std::integral_constant<bool, std::is_empty<std::decay_t<Function>>::value &&
+                                                               !std::is_final<std::decay_t<Function>>::value &&
+                                                               std::is_trivially_copyable<std::decay_t<Function>>::value> {
+    };
+
+    /**
+     * Stores a callable by its real type, so that calls to it can be inlined. Lambdas are not assignable (and not default
+     * constructible before C++20), so the callable is kept in a union and reconstructed on assignment.
+     */
+    template<class Function, class = void>
+    class FunctionContainer {
+        using Fn = std::decay_t<Function>;
+
+        union {
+            mutable Fn _function;
+        };
+        bool _isConstructed{false};
+
+        template<class... Args>
+        void construct(Args&& ... args) {
+            ::new(static_cast<void*>(std::addressof(_function))) Fn(std::forward<Args>(args)...);
+            _isConstructed = true;
+        }
+
+        void reset() noexcept {
+            if (_isConstructed) {
+                _function.~Fn();
+                _isConstructed = false;
+            }
+        }
+
+    public:
+        FunctionContainer() noexcept {
+        }
+
+        explicit FunctionContainer(const Fn& function) {
+            construct(function);
+        }
+
+        FunctionContainer(const FunctionContainer& other) {
+            if (other._isConstructed) {
+                construct(other._function);
+            }
+        }
+
+        FunctionContainer(FunctionContainer&& other) noexcept(std::is_nothrow_move_constructible<Fn>::value) {
+            if (other._isConstructed) {
+                construct(std::move(other._function));
+            }
+        }
+
+        FunctionContainer& operator=(const FunctionContainer& other) {
+            if (this != &other) {
+                reset();
+                if (other._isConstructed) {
+                    construct(other._function);
+                }
+            }
+            return *this;
+        }
+
+        FunctionContainer& operator=(FunctionContainer&& other) noexcept(std::is_nothrow_move_constructible<Fn>::value) {
+            if (this != &other) {
+                reset();
+                if (other._isConstructed) {
+                    construct(std::move(other._function));
+                }
+            }
+            return *this;
+        }
+
+        ~FunctionContainer() {
+            reset();
+        }
+
+        template<class... Args>
+        FunctionReturnType<Fn&, Args...> operator()(Args&& ... args) const {
+            return _function(std::forward<Args>(args)...);
+        }
+
+        const Fn& function() const {
+            return _function;
+        }
+    };
+
+    /**
+     * Stateless function objects take up no space at all. An empty, trivially copyable object has no state to copy or
+     * assign, so assignment does nothing, which lets stateless lambdas, that have no assignment operator, get this layout as
+     * well. Such a container is only default constructible if the function object is.
+     */
+    template<class Function>
+    class FunctionContainer<Function, std::enable_if_t<IsEmptyBaseCandidate<Function>::value>> : private std::decay_t<Function> {
+        using Fn = std::decay_t<Function>;
+
+    public:
+        template<class F = Fn, std::enable_if_t<std::is_default_constructible<F>::value, int> = 0>
+        FunctionContainer() :
+            Fn() {
+        }
+
+        explicit FunctionContainer(const Fn& function) :
+            Fn(function) {
+        }
+
+        FunctionContainer(const FunctionContainer& other) = default;
+
+        FunctionContainer& operator=(const FunctionContainer& /*other*/) noexcept {
+            return *this;
+        }
+
+        template<class... Args>
+        FunctionReturnType<const Fn&, Args...> operator()(Args&& ... args) const {
+            return static_cast<const Fn&>(*this)(std::forward<Args>(args)...);
+        }
+
+        const Fn& function() const {
+            return *this;
+        }
+    };
+
+    /**
+     * The end of an iterator in the form in which other iterators store it. By default this is the end iterator itself.
+     * Iterators that are at their end exactly when their underlying iterator is at its end, such as those of Filter and Map,
+     * overload `sentinelOf` and `reachedEnd` as hidden friends and use the sentinel of their underlying iterator instead.
+     * Without that, an iterator that stores the end of a nested iterator would store all its state twice, so that the size
+     * of the iterators of a pipeline doubles with every stage.
+     */
+    template<class Iterator>
+    Iterator sentinelOf(const Iterator& end) {
+        return end;
+    }
+
+    template<class Iterator>
+    bool reachedEnd(const Iterator& iterator, const Iterator& end) {
+        return iterator == end;
+    }
+
+    template<class Iterator>
+    using SentinelOf = decltype(sentinelOf(std::declval<const Iterator&>()));
+
+    // std::find_if over [iterator, end), where end may be a sentinel
+    template<class Iterator, class Predicate>
+    Iterator findIf(const Iterator iterator, const Iterator& end, Predicate predicate) {
+        return std::find_if(iterator, end, predicate);
+    }
+
+    template<class Iterator, class Sentinel, class Predicate>
+    Iterator findIf(Iterator iterator, const Sentinel& end, Predicate predicate) {
+        while (!reachedEnd(iterator, end) && !predicate(*iterator)) {
+            ++iterator;
+        }
+        return iterator;
+    }
+
+    // An iterator is computed if its operator* returns a new value every time, e.g. the result of a function, rather than a
+    // reference to a stored value
+    template<class Iterator>
+    using IsComputed = std::integral_constant<bool, !std::is_reference<typename std::iterator_traits<Iterator>::reference>::value>;
+
+    /**
+     * Holds at most one value that is constructed in place, like `std::optional`. Used by iterators that keep the computed
+     * value they looked at, so that dereferencing them does not compute it a second time.
+     */
+    template<class T>
+    class CachedValue {
+        union {
+            T _value;
+        };
+        bool _hasValue{false};
+
+    public:
+        CachedValue() noexcept {
+        }
+
+        CachedValue(const CachedValue& other) {
+            if (other._hasValue) {
+                emplace(other._value);
+            }
+        }
+
+        CachedValue(CachedValue&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+            if (other._hasValue) {
+                emplace(std::move(other._value));
+            }
+        }
+
+        CachedValue& operator=(const CachedValue& other) {
+            if (this != &other) {
+                reset();
+                if (other._hasValue) {
+                    emplace(other._value);
+                }
+            }
+            return *this;
+        }
+
+        CachedValue& operator=(CachedValue&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+            if (this != &other) {
+                reset();
+                if (other._hasValue) {
+                    emplace(std::move(other._value));
+                }
+            }
+            return *this;
+        }
+
+        ~CachedValue() {
+            reset();
+        }
+
+        template<class... Args>
+        void emplace(Args&& ... args) {
+            reset();
+            ::new(static_cast<void*>(std::addressof(_value))) T(std::forward<Args>(args)...);
+            _hasValue = true;
+        }
+
+        void reset() noexcept {
+            if (_hasValue) {
+                _value.~T();
+                _hasValue = false;
+            }
+        }
+
+        bool hasValue() const noexcept {
+            return _hasValue;
+        }
+
+        const T& get() const noexcept {
+            return _value;
+        }
+    };
+
     template<class Arithmetic>
     inline bool isEven(const Arithmetic value) {
         return (value & 1) == 0;
     }
+
+    enum class SizeHintKind {
+        Unknown,
+        UpperBound,
+        Exact
+    };
+
+    // An upper bound may be far above the actual amount, e.g. for a filter that rejects almost everything, so at most
+    // this many elements are reserved for it
+    constexpr std::size_t MaxUpperBoundReserve = 1024;
+
+    /**
+     * Describes how many elements a view yields, without iterating over it. Used by the materializers to allocate once.
+     */
+    struct SizeHint {
+        SizeHintKind kind{SizeHintKind::Unknown};
+        std::size_t size{};
+
+        static constexpr SizeHint unknown() {
+            return SizeHint{};
+        }
+
+        static constexpr SizeHint upperBound(const std::size_t size) {
+            return SizeHint{SizeHintKind::UpperBound, size};
+        }
+
+        static constexpr SizeHint exact(const std::size_t size) {
+            return SizeHint{SizeHintKind::Exact, size};
+        }
+
+        constexpr bool isKnown() const {
+            return kind != SizeHintKind::Unknown;
+        }
+
+        // The amount of elements to reserve storage for
+        constexpr std::size_t reserveSize() const {
+            return kind == SizeHintKind::Exact ? size :
+                   kind == SizeHintKind::UpperBound ? (size < MaxUpperBoundReserve ? size : MaxUpperBoundReserve) : 0;
+        }
+    };
+
+    template<class Iterator>
+    using IsRandomAccess = std::is_convertible<typename std::iterator_traits<Iterator>::iterator_category,
+                                               std::random_access_iterator_tag>;
+
+#ifdef HAS_CXX_20
+    template<class Iterator>
+    struct IsContiguous : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {
+    };
+#else
+    template<class T>
+    struct IsCharacter : std::integral_constant<bool, std::is_same<T, char>::value || std::is_same<T, wchar_t>::value ||
+                                                      std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value> {
+    };
+
+    template<class Iterator, class Container>
+    struct IsIteratorOf : std::integral_constant<bool, std::is_same<Iterator, typename Container::iterator>::value ||
+                                                       std::is_same<Iterator, typename Container::const_iterator>::value> {
+    };
+
+    template<class Iterator>
+    struct IsIteratorOf<Iterator, void> : std::false_type {
+    };
+
+    template<class T>
+    using ContiguousContainer = std::conditional_t<std::is_array<T>::value || std::is_same<T, bool>::value, void,
+        std::conditional_t<IsCharacter<T>::value, std::basic_string<T>, std::vector<T>>>;
+
+    // Before C++20 iterators cannot tell whether they are contiguous, so only pointers and the iterators of std::vector and
+    // std::basic_string (with their default allocators) are recognized
+    template<class Iterator>
+    struct IsContiguous : std::integral_constant<bool, std::is_pointer<Iterator>::value ||
+        IsIteratorOf<Iterator, ContiguousContainer<typename std::iterator_traits<Iterator>::value_type>>::value> {
+    };
+#endif
+
+    template<class Iterator>
+    SizeHint sizeHintOf(const Iterator begin, const Iterator end, std::random_access_iterator_tag /*tag*/) {
+        const auto distance = std::distance(begin, end);
+        return SizeHint::exact(distance > 0 ? static_cast<std::size_t>(distance) : 0);
+    }
+
+    template<class Iterator>
+    SizeHint sizeHintOf(const Iterator /*begin*/, const Iterator /*end*/, std::input_iterator_tag /*tag*/) {
+        return SizeHint::unknown();
+    }
+
+    // Exact amount of elements between [begin, end) if that can be computed in constant time, unknown otherwise
+    template<class Iterator>
+    SizeHint sizeHintOf(const Iterator begin, const Iterator end) {
+        return sizeHintOf(begin, end, typename std::iterator_traits<Iterator>::iterator_category());
+    }
+
+    // Views that skip elements of [begin, end) yield at most the amount of elements of [begin, end)
+    template<class Iterator>
+    SizeHint upperBoundOf(const Iterator begin, const Iterator end) {
+        const SizeHint hint = sizeHintOf(begin, end);
+        return hint.isKnown() ? SizeHint::upperBound(hint.size) : hint;
+    }
+
+    template<class Container, class = void>
+    struct HasReserve : std::false_type {
+    };
+
+    template<class Container>
+    struct HasReserve<Container, decltype(std::declval<Container&>().reserve(std::size_t()), void())> : std::true_type {
+    };
+
+    template<class Container, class = void>
+    struct HasPushBack : std::false_type {
+    };
+
+    template<class Container>
+    struct HasPushBack<Container, decltype(std::declval<Container&>().push_back(
+        std::declval<const typename Container::value_type&>()), void())> : std::true_type {
+    };
+
+    template<class Container>
+    void reserve(Container& container, const SizeHint hint, std::true_type /*hasReserve*/) {
+        if (hint.isKnown()) {
+            container.reserve(hint.reserveSize());
+        }
+    }
+
+    template<class Container>
+    void reserve(Container& /*container*/, const SizeHint /*hint*/, std::false_type /*hasReserve*/) {
+    }
+
+    template<class Container>
+    void reserve(Container& container, const SizeHint hint) {
+        reserve(container, hint, HasReserve<Container>());
+    }
+
+    template<class Container>
+    std::back_insert_iterator<Container> makeInserter(Container& container, std::true_type /*hasPushBack*/) {
+        return std::back_inserter(container);
+    }
+
+    template<class Container>
+    std::insert_iterator<Container> makeInserter(Container& container, std::false_type /*hasPushBack*/) {
+        return std::inserter(container, container.end());
+    }
+
+    template<class Container>
+    auto makeInserter(Container& container) -> decltype(makeInserter(container, HasPushBack<Container>())) {
+        return makeInserter(container, HasPushBack<Container>());
+    }
 }}
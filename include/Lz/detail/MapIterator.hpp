@@ -1,6 +1,9 @@
 #pragma once
 
-#include <functional>
+#include <iterator>
+
+#include "ForEachChunk.hpp"
+#include "LzTools.hpp"
 
 
 namespace lz {
@@ -13,9 +16,10 @@ namespace lz {
         class MapIterator {
         private:
             Iterator _iterator{};
+            FunctionContainer<Function> _function{};
+
             using FnParamType = decltype(*_iterator);
             using FnReturnType = detail::FunctionReturnType<Function, FnParamType>;
-            const std::function<FnReturnType(FnParamType)>* _function{};
 
             friend class Map<Iterator, Function>;
         public:
@@ -25,15 +29,45 @@ namespace lz {
             using reference = value_type;
             using pointer = FakePointerProxy<reference>;
 
-            MapIterator(const Iterator iterator, const std::function<FnReturnType(FnParamType)>* function) :
+            MapIterator(const Iterator iterator, const FunctionContainer<Function>& function) :
                 _iterator(iterator),
                 _function(function) {
             }
 
             MapIterator() = default;
 
+            friend SentinelOf<Iterator> sentinelOf(const MapIterator& end) {
+                return sentinelOf(end._iterator);
+            }
+
+            friend bool reachedEnd(const MapIterator& iterator, const SentinelOf<Iterator>& end) {
+                return reachedEnd(iterator._iterator, end);
+            }
+
+            // Every chunk of the underlying sequence is mapped in one tight loop
+            template<class Sink, class V = value_type, std::enable_if_t<IsBufferable<V>::value &&
+                IsInvocable<const FunctionContainer<Function>&, const ValueType<Iterator>&>::value, int> = 0>
+            friend void forEachChunk(const MapIterator begin, const MapIterator end, Sink& sink) {
+                constexpr std::size_t chunkSize = chunkSizeOf<value_type>();
+                value_type buffer[chunkSize];
+                const FunctionContainer<Function>& function = begin._function;
+
+                auto mapChunk = [&](const auto* data, std::size_t count) {
+                    while (count > 0) {
+                        const std::size_t mapped = count < chunkSize ? count : chunkSize;
+                        for (std::size_t i = 0; i < mapped; i++) {
+                            buffer[i] = function(data[i]);
+                        }
+                        sink(static_cast<const value_type*>(buffer), mapped);
+                        data += mapped;
+                        count -= mapped;
+                    }
+                };
+                visitChunks(begin._iterator, end._iterator, mapChunk);
+            }
+
             value_type operator*() const {
-                return (*_function)(*_iterator);
+                return _function(*_iterator);
             }
 
             FakePointerProxy <reference> operator->() const {
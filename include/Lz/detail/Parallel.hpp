@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LzTools.hpp"
+
+
+namespace lz {
+    /**
+     * Execution policy that splits random access sequences into chunks and processes them on multiple threads. Use the
+     * `lz::par` object for the defaults, or construct one to specify the amount of threads and the minimum chunk size.
+     */
+    struct ParallelPolicy {
+        // The maximum amount of threads to use, 0 means `std::thread::hardware_concurrency()`
+        std::size_t threadCount{};
+        // Sequences smaller than this are not split up, as the cost of handing a chunk to a thread would outweigh the gain
+        std::size_t minChunkSize{};
+
+        constexpr explicit ParallelPolicy(const std::size_t threadCount = 0, const std::size_t minChunkSize = 1 << 14) :
+            threadCount(threadCount),
+            minChunkSize(minChunkSize == 0 ? 1 : minChunkSize) {
+        }
+    };
+
+    constexpr ParallelPolicy par{};
+
+    namespace detail {
+        /**
+         * The threads that process the chunks of parallel algorithms. They are started once, on first use, and live until the
+         * program exits. A thread that waits for its chunks runs queued chunks itself, so that nested parallel algorithms,
+         * and chunks that outnumber the threads, cannot deadlock the pool.
+         */
+        class ThreadPool {
+            std::vector<std::thread> _threads;
+            std::deque<std::function<void()>> _tasks;
+            std::mutex _mutex;
+            std::condition_variable _condition;
+            bool _stopping{};
+
+            void work() {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _condition.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                        if (_tasks.empty()) {
+                            return;
+                        }
+                        task = std::move(_tasks.front());
+                        _tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+            ThreadPool() {
+                // The thread that submits the chunks processes one of them as well
+                const std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+                _threads.reserve(threads);
+                for (std::size_t i = 0; i < threads; i++) {
+                    _threads.emplace_back([this] { work(); });
+                }
+            }
+
+        public:
+            ThreadPool(const ThreadPool&) = delete;
+
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stopping = true;
+                }
+                _condition.notify_all();
+                for (std::thread& thread : _threads) {
+                    thread.join();
+                }
+            }
+
+            static ThreadPool& instance() {
+                static ThreadPool pool;
+                return pool;
+            }
+
+            template<class Function>
+            std::future<FunctionReturnType<Function>> submit(Function function) {
+                // std::function must be copyable, a packaged_task is not
+                auto task = std::make_shared<std::packaged_task<FunctionReturnType<Function>()>>(std::move(function));
+                std::future<FunctionReturnType<Function>> future = task->get_future();
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _tasks.emplace_back([task] { (*task)(); });
+                }
+                _condition.notify_one();
+                return future;
+            }
+
+            // Runs queued tasks on the calling thread until `future` is ready or there are no queued tasks left. In the latter
+            // case, the task of `future` is already running on another thread, so that it is safe to block on it.
+            template<class T>
+            void wait(const std::future<T>& future) {
+                while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    std::function<void()> task;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (_tasks.empty()) {
+                            break;
+                        }
+                        task = std::move(_tasks.front());
+                        _tasks.pop_front();
+                    }
+                    task();
+                }
+                future.wait();
+            }
+        };
+
+        inline std::size_t chunkCount(const ParallelPolicy policy, const std::size_t size) {
+            const std::size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+            const std::size_t threads = policy.threadCount == 0 ? hardwareThreads : policy.threadCount;
+            return std::max(std::min(threads, size / policy.minChunkSize), static_cast<std::size_t>(1));
+        }
+
+        /**
+         * Splits [0, size) in (almost) equally sized chunks and calls `function(from, to)` for every chunk, where every chunk
+         * except the first one is handed to the thread pool. Exceptions thrown by `function` are rethrown, after every chunk
+         * has finished.
+         * @return The results of `function`, ordered by chunk.
+         */
+        template<class Function>
+        std::vector<FunctionReturnType<Function, std::size_t, std::size_t>>
+        parallelChunks(const ParallelPolicy policy, const std::size_t size, Function function) {
+            using Result = FunctionReturnType<Function, std::size_t, std::size_t>;
+
+            const std::size_t chunks = chunkCount(policy, size);
+            const std::size_t chunkSize = size / chunks;
+            const std::size_t remainder = size % chunks;
+
+            ThreadPool& pool = ThreadPool::instance();
+            std::vector<std::future<Result>> futures;
+            futures.reserve(chunks - 1);
+
+            // The first `remainder` chunks get one extra element
+            std::size_t from = chunkSize + (remainder > 0 ? 1 : 0);
+            for (std::size_t chunk = 1; chunk < chunks; chunk++) {
+                const std::size_t to = from + chunkSize + (chunk < remainder ? 1 : 0);
+                futures.push_back(pool.submit([function, from, to]() mutable { return function(from, to); }));
+                from = to;
+            }
+
+            std::vector<Result> results;
+            results.reserve(chunks);
+            // The chunks may refer to the caller's data, so they must all have finished before anything is rethrown
+            std::exception_ptr exception;
+            try {
+                results.push_back(function(0, chunkSize + (remainder > 0 ? 1 : 0)));
+            }
+            catch (...) {
+                exception = std::current_exception();
+            }
+
+            for (const std::future<Result>& future : futures) {
+                pool.wait(future);
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            for (std::future<Result>& future : futures) {
+                results.push_back(future.get());
+            }
+            return results;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    // Base of the objects that are returned by e.g. `lz::map(function)` and that can be used as `iterable | adaptor`
+    struct PipeAdaptor {
+    };
+
+    template<class Adaptor>
+    using IsPipeAdaptor = std::is_base_of<PipeAdaptor, std::decay_t<Adaptor>>;
+
+    // Is specialized for a view and an adaptor whose stages are merged into one view by an overload of `operator|` that
+    // is declared next to the view
+    template<class View, class Adaptor>
+    struct IsFusable : std::false_type {
+    };
+
+    template<class Iterable, class Adaptor, std::enable_if_t<IsPipeAdaptor<Adaptor>::value &&
+        !IsFusable<std::decay_t<Iterable>, Adaptor>::value, int> = 0>
+    auto operator|(Iterable&& iterable, const Adaptor& adaptor) -> decltype(adaptor(std::forward<Iterable>(iterable))) {
+        return adaptor(std::forward<Iterable>(iterable));
+    }
+
+    // `second(first(value))`, the function of two map stages that are fused
+    template<class First, class Second>
+    class ComposedFunction {
+        std::decay_t<First> _first;
+        std::decay_t<Second> _second;
+
+    public:
+        ComposedFunction(const std::decay_t<First>& first, const std::decay_t<Second>& second) :
+            _first(first),
+            _second(second) {
+        }
+
+        template<class T>
+        auto operator()(T&& value) const -> decltype(_second(_first(std::forward<T>(value)))) {
+            return _second(_first(std::forward<T>(value)));
+        }
+    };
+
+    // `first(value) && second(value)`, the predicate of two filter stages that are fused
+    template<class First, class Second>
+    class ConjoinedPredicate {
+        std::decay_t<First> _first;
+        std::decay_t<Second> _second;
+
+    public:
+        ConjoinedPredicate(const std::decay_t<First>& first, const std::decay_t<Second>& second) :
+            _first(first),
+            _second(second) {
+        }
+
+        template<class T>
+        bool operator()(const T& value) const {
+            return _first(value) && _second(value);
+        }
+    };
+}}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+
+namespace lz {
+    /**
+     * The xoshiro256++ pseudo random number generator by David Blackman and Sebastiano Vigna. It satisfies
+     * UniformRandomBitGenerator, has a state of 32 bytes and produces 64 random bits per call, which makes it a lot
+     * cheaper to create, copy and call than `std::mt19937`. It is not suitable for cryptographic purposes.
+     */
+    class Xoshiro256PlusPlus {
+        std::uint64_t _state[4]{};
+
+        static constexpr std::uint64_t rotateLeft(const std::uint64_t x, const int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        // Expands a 64 bit seed into the full state, as recommended by the authors
+        static std::uint64_t splitMix64(std::uint64_t& x) {
+            std::uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+    public:
+        using result_type = std::uint64_t;
+
+        explicit Xoshiro256PlusPlus(const std::uint64_t seed = 0) {
+            this->seed(seed);
+        }
+
+        void seed(std::uint64_t seed) {
+            for (std::uint64_t& state : _state) {
+                state = splitMix64(seed);
+            }
+        }
+
+        static constexpr result_type min() {
+            return 0;
+        }
+
+        static constexpr result_type max() {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        result_type operator()() {
+            const std::uint64_t result = rotateLeft(_state[0] + _state[3], 23) + _state[0];
+            const std::uint64_t t = _state[1] << 17;
+
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= t;
+            _state[3] = rotateLeft(_state[3], 45);
+
+            return result;
+        }
+
+        /**
+         * Writes `count` random values to `out`. The state is kept in registers for the whole block, which is
+         * considerably faster than calling `operator()` `count` times through a pointer or reference.
+         */
+        void generate(std::uint64_t* out, const std::size_t count) {
+            std::uint64_t s0 = _state[0], s1 = _state[1], s2 = _state[2], s3 = _state[3];
+
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = rotateLeft(s0 + s3, 23) + s0;
+                const std::uint64_t t = s1 << 17;
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+                s2 ^= t;
+                s3 = rotateLeft(s3, 45);
+            }
+
+            _state[0] = s0;
+            _state[1] = s1;
+            _state[2] = s2;
+            _state[3] = s3;
+        }
+    };
+
+    namespace detail {
+        inline std::uint64_t randomSeed() {
+            std::random_device device;
+            return (static_cast<std::uint64_t>(device()) << 32) ^ static_cast<std::uint64_t>(device());
+        }
+
+        // Every thread gets its own engine, seeded by std::random_device the first time the thread asks for it
+        template<class Engine>
+        Engine& threadLocalEngine() {
+            thread_local Engine engine(static_cast<typename Engine::result_type>(randomSeed()));
+            return engine;
+        }
+
+        template<class Engine>
+        struct IsFullRange64 : std::integral_constant<bool, Engine::min() == 0 &&
+                                                            Engine::max() == std::numeric_limits<std::uint64_t>::max()> {
+        };
+
+        // Returns the high 64 bits of a * b and stores the low 64 bits in low
+        inline std::uint64_t multiplyHigh(const std::uint64_t a, const std::uint64_t b, std::uint64_t& low) {
+#if defined(__SIZEOF_INT128__)
+            // __extension__ keeps -Wpedantic quiet about the non standard type
+            __extension__ typedef unsigned __int128 UInt128;
+            const UInt128 product = static_cast<UInt128>(a) * b;
+            low = static_cast<std::uint64_t>(product);
+            return static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+            std::uint64_t high;
+            low = _umul128(a, b, &high);
+            return high;
+#else
+            const std::uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+            const std::uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+            const std::uint64_t lowLow = aLow * bLow;
+            const std::uint64_t highLow = aHigh * bLow;
+            const std::uint64_t lowHigh = aLow * bHigh;
+            const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+            low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+            return aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+#endif
+        }
+
+        /**
+         * Uniform integer distribution over [min, max] for engines that produce 64 random bits per call. It uses Lemire's
+         * multiply and shift method, which only needs a division in the rare case that a value has to be rejected.
+         */
+        template<class Integral>
+        class FastUniformIntDistribution {
+            using Unsigned = std::make_unsigned_t<Integral>;
+
+            Integral _min{};
+            // max - min, so the amount of possible values minus one
+            std::uint64_t _span{};
+
+        public:
+            using result_type = Integral;
+
+            FastUniformIntDistribution(const Integral min, const Integral max) :
+                _min(min),
+                _span(static_cast<std::uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min)))) {
+            }
+
+            FastUniformIntDistribution() = default;
+
+            // Maps 64 random bits to [min, max], the rare rejected values are replaced by new bits from engine
+            template<class Engine>
+            Integral fromBits(const std::uint64_t bits, Engine& engine) const {
+                if (_span == std::numeric_limits<std::uint64_t>::max()) {
+                    return static_cast<Integral>(bits);
+                }
+                const std::uint64_t range = _span + 1;
+                std::uint64_t low;
+                std::uint64_t high = multiplyHigh(bits, range, low);
+
+                if (low < range) {
+                    const std::uint64_t threshold = (0 - range) % range;
+                    while (low < threshold) {
+                        high = multiplyHigh(engine(), range, low);
+                    }
+                }
+                return static_cast<Integral>(static_cast<Unsigned>(static_cast<Unsigned>(_min) + static_cast<Unsigned>(high)));
+            }
+
+            template<class Engine>
+            Integral operator()(Engine& engine) const {
+                static_assert(IsFullRange64<Engine>::value, "the engine must produce 64 random bits per call");
+                return fromBits(engine(), engine);
+            }
+        };
+
+        // Uniform floating point distribution over [min, max) for engines that produce 64 random bits per call
+        template<class Real>
+        class FastUniformRealDistribution {
+            Real _min{};
+            Real _span{};
+
+        public:
+            using result_type = Real;
+
+            FastUniformRealDistribution(const Real min, const Real max) :
+                _min(min),
+                _span(max - min) {
+            }
+
+            FastUniformRealDistribution() = default;
+
+            // The upper bits are converted to a value in [0, 1), as many as the mantissa can hold exactly (at most 53)
+            Real fromBits(const std::uint64_t bits) const {
+                constexpr int mantissaBits = std::numeric_limits<Real>::digits < 53 ? std::numeric_limits<Real>::digits : 53;
+                constexpr Real scale = static_cast<Real>(1) / static_cast<Real>(std::uint64_t(1) << mantissaBits);
+                return _min + _span * (static_cast<Real>(bits >> (64 - mantissaBits)) * scale);
+            }
+
+            template<class Engine>
+            Real operator()(Engine& engine) const {
+                static_assert(IsFullRange64<Engine>::value, "the engine must produce 64 random bits per call");
+                return fromBits(engine());
+            }
+        };
+
+        template<class Arithmetic, class Engine>
+        using UniformDistribution = std::conditional_t<IsFullRange64<Engine>::value,
+            std::conditional_t<std::is_floating_point<Arithmetic>::value, FastUniformRealDistribution<Arithmetic>,
+                FastUniformIntDistribution<Arithmetic>>,
+            std::conditional_t<std::is_floating_point<Arithmetic>::value, std::uniform_real_distribution<Arithmetic>,
+                std::uniform_int_distribution<Arithmetic>>>;
+
+        template<class Engine, class Distribution, class OutputIterator>
+        OutputIterator fillRandom(Engine& engine, Distribution& distribution, OutputIterator out, const std::size_t count) {
+            for (std::size_t i = 0; i < count; i++, ++out) {
+                *out = distribution(engine);
+            }
+            return out;
+        }
+
+        constexpr std::size_t RandomBlockSize = 256;
+
+        // Random bits are generated a block at a time, after which they are converted to values in a separate loop that
+        // the compiler can vectorize
+        template<class Real, class OutputIterator>
+        OutputIterator fillRandom(Xoshiro256PlusPlus& engine, FastUniformRealDistribution<Real>& distribution,
+                                  OutputIterator out, std::size_t count) {
+            std::uint64_t bits[RandomBlockSize];
+
+            while (count > 0) {
+                const std::size_t blockSize = count < RandomBlockSize ? count : RandomBlockSize;
+                engine.generate(bits, blockSize);
+                for (std::size_t i = 0; i < blockSize; i++, ++out) {
+                    *out = distribution.fromBits(bits[i]);
+                }
+                count -= blockSize;
+            }
+            return out;
+        }
+
+        template<class Integral, class OutputIterator>
+        OutputIterator fillRandom(Xoshiro256PlusPlus& engine, FastUniformIntDistribution<Integral>& distribution,
+                                  OutputIterator out, std::size_t count) {
+            std::uint64_t bits[RandomBlockSize];
+
+            while (count > 0) {
+                const std::size_t blockSize = count < RandomBlockSize ? count : RandomBlockSize;
+                engine.generate(bits, blockSize);
+                for (std::size_t i = 0; i < blockSize; i++, ++out) {
+                    *out = distribution.fromBits(bits[i], engine);
+                }
+                count -= blockSize;
+            }
+            return out;
+        }
+    }
+}
@@ -3,13 +3,13 @@
 #include <iterator>
 #include <random>
 #include <limits>
+#include <memory>
 
 #include "LzTools.hpp"
-#include <chrono>
-#include <iostream>
+#include "RandomEngine.hpp"
 
 namespace lz { namespace detail {
-    template<class Arithmetic, class Distribution>
+    template<class Arithmetic, class Distribution, class Engine>
     class RandomIterator {
     public:
         using iterator_category = std::random_access_iterator_tag;
@@ -20,24 +20,24 @@ namespace lz { namespace detail {
 
     private:
         size_t _current{};
-        Arithmetic _min{}, _max{};
+        mutable Distribution _distribution{};
+        // The engine of a seeded view, or nullptr to use the engine of the calling thread
+        std::shared_ptr<Engine> _engine{};
         bool _isWhileTrueLoop{};
 
     public:
-        explicit RandomIterator(const Arithmetic min, const Arithmetic max, const size_t current, const bool isWhileTrueLoop) :
+        explicit RandomIterator(const Distribution& distribution, std::shared_ptr<Engine> engine, const size_t current,
+                                const bool isWhileTrueLoop) :
             _current(current),
-            _min(min),
-            _max(max),
+            _distribution(distribution),
+            _engine(std::move(engine)),
             _isWhileTrueLoop(isWhileTrueLoop) {
         }
 
         RandomIterator() = default;
 
         value_type operator*() const {
-            static std::random_device randomEngine;
-            static std::mt19937 generator(randomEngine());
-            Distribution randomNumber(_min, _max);
-            return randomNumber(generator);
+            return _distribution(_engine == nullptr ? threadLocalEngine<Engine>() : *_engine);
         }
 
         pointer operator->() const {
@@ -1,111 +1,225 @@
 #pragma once
 
 #include <iterator>
+#include <cstddef>
+#include <type_traits>
+
+#include "ClosedForm.hpp"
+#include "ForEachChunk.hpp"
 
 
 namespace lz { namespace detail {
+    // Integers of a range are computed in this type, in which the distance between any two values fits and which wraps
+    // around instead of overflowing. Types smaller than int are promoted first, as they would be promoted to (signed) int.
+    template<class Integral>
+    using RangeUnsigned = std::make_unsigned_t<std::common_type_t<Integral, int>>;
+
     template<class Arithmetic>
-    class RangeIterator {
-        Arithmetic _iterator{};
-        Arithmetic _step{};
+    constexpr std::size_t rangeLength(const Arithmetic start, const Arithmetic end, const Arithmetic step,
+                                      std::false_type /*isIntegral*/) {
+        const auto steps = static_cast<std::size_t>((end - start) / step);
+        return start + static_cast<Arithmetic>(steps) * step == end ? steps : steps + 1;
+    }
+
+    template<class Arithmetic>
+    constexpr std::size_t rangeLength(const Arithmetic start, const Arithmetic end, const Arithmetic step,
+                                      std::true_type /*isIntegral*/) {
+        using Unsigned = RangeUnsigned<Arithmetic>;
+        const Unsigned distance = step > 0 ? static_cast<Unsigned>(end) - static_cast<Unsigned>(start) :
+                                  static_cast<Unsigned>(start) - static_cast<Unsigned>(end);
+        const Unsigned stride = step > 0 ? static_cast<Unsigned>(step) : Unsigned(0) - static_cast<Unsigned>(step);
+        return static_cast<std::size_t>(distance / stride + (distance % stride == 0 ? 0 : 1));
+    }
+
+    // Amount of steps from start until end is reached or passed
+    template<class Arithmetic>
+    constexpr std::size_t rangeLength(const Arithmetic start, const Arithmetic end, const Arithmetic step) {
+        if (step > 0 ? end <= start : end >= start) {
+            return 0;
+        }
+        return rangeLength(start, end, step, std::is_integral<Arithmetic>());
+    }
 
+    /**
+     * Yields `start + index * step`, so that the values of a floating point range do not drift from repeatedly adding the
+     * step, and a range can be split at any index. The end is an index as well, see `rangeLength`.
+     */
+    template<class Arithmetic>
+    class RangeIterator {
     public:
         using iterator_category = std::random_access_iterator_tag;
         using value_type = Arithmetic;
-        using difference_type = Arithmetic;
-        using pointer = const Arithmetic*;
+        using difference_type = std::ptrdiff_t;
         using reference = Arithmetic;
+        using pointer = FakePointerProxy<reference>;
+
+    private:
+        Arithmetic _start{};
+        Arithmetic _step{};
+        difference_type _index{};
+
+    public:
+        constexpr RangeIterator(const Arithmetic start, const Arithmetic step, const difference_type index) :
+            _start(start),
+            _step(step),
+            _index(index) {
+        }
 
-        RangeIterator(const Arithmetic iterator, const Arithmetic step) :
-            _iterator(iterator),
-            _step(step) {
+        constexpr RangeIterator() = default;
+
+        // The values of a range are written a chunk at a time, in a loop without branches that can be vectorized
+        template<class Sink>
+        friend void forEachChunk(const RangeIterator begin, const RangeIterator end, Sink& sink) {
+            forEachRangeChunk(begin, end, sink, std::is_integral<Arithmetic>());
         }
 
-        RangeIterator() = default;
+        // An arithmetic series. Integers are summed as count times the middle element, or half the count times the sum of the
+        // first and the last element, so that no intermediate result overflows unless the sum itself does.
+        friend Arithmetic stridedSum(const RangeIterator first, const std::size_t count, const std::size_t stride) {
+            if (count == 0) {
+                return 0;
+            }
+            const difference_type lastOffset = static_cast<difference_type>((count - 1) * stride);
+            if (std::is_floating_point<Arithmetic>::value) {
+                return static_cast<Arithmetic>(static_cast<Arithmetic>(count) * (*first + first[lastOffset]) / 2);
+            }
+            if (count % 2 == 1) {
+                return static_cast<Arithmetic>(static_cast<Arithmetic>(count) * first[lastOffset / 2]);
+            }
+            return static_cast<Arithmetic>(static_cast<Arithmetic>(count / 2) * (*first + first[lastOffset]));
+        }
+
+    private:
+        // Integers are exact, so the next value is the previous one plus the step. The sum is unsigned, so stepping past the
+        // last value, which may lie beyond the limits of Arithmetic, wraps around rather than overflowing.
+        template<class Sink>
+        static void forEachRangeChunk(const RangeIterator begin, const RangeIterator end, Sink& sink, std::true_type /*isIntegral*/) {
+            using Unsigned = RangeUnsigned<Arithmetic>;
+            constexpr std::size_t chunkSize = chunkSizeOf<Arithmetic>();
+            Arithmetic buffer[chunkSize];
+            Unsigned current = static_cast<Unsigned>(*begin);
+            const Unsigned step = static_cast<Unsigned>(begin._step);
+            std::size_t remaining = static_cast<std::size_t>(end - begin);
+
+            while (remaining > 0) {
+                const std::size_t count = remaining < chunkSize ? remaining : chunkSize;
+                for (std::size_t i = 0; i < count; i++) {
+                    buffer[i] = static_cast<Arithmetic>(current);
+                    current += step;
+                }
+                sink(static_cast<const Arithmetic*>(buffer), count);
+                remaining -= count;
+            }
+        }
 
-        value_type operator*() const {
-            return _iterator;
+        template<class Sink>
+        static void forEachRangeChunk(const RangeIterator begin, const RangeIterator end, Sink& sink, std::false_type /*isIntegral*/) {
+            constexpr std::size_t chunkSize = chunkSizeOf<Arithmetic>();
+            Arithmetic buffer[chunkSize];
+            difference_type index = begin._index;
+
+            while (index < end._index) {
+                const difference_type left = end._index - index;
+                const std::size_t count = left < static_cast<difference_type>(chunkSize) ? static_cast<std::size_t>(left) : chunkSize;
+                for (std::size_t i = 0; i < count; i++) {
+                    buffer[i] = begin._start + static_cast<Arithmetic>(index + static_cast<difference_type>(i)) * begin._step;
+                }
+                sink(static_cast<const Arithmetic*>(buffer), count);
+                index += static_cast<difference_type>(count);
+            }
+        }
+
+        // The value itself is in range, but the product and sum may not be, so they are computed in the unsigned type
+        constexpr value_type valueAt(const difference_type index, std::true_type /*isIntegral*/) const {
+            using Unsigned = RangeUnsigned<Arithmetic>;
+            return static_cast<value_type>(static_cast<Unsigned>(_start) +
+                                           static_cast<Unsigned>(index) * static_cast<Unsigned>(_step));
+        }
+
+        constexpr value_type valueAt(const difference_type index, std::false_type /*isIntegral*/) const {
+            return static_cast<value_type>(_start + static_cast<value_type>(index) * _step);
+        }
+
+    public:
+        constexpr value_type operator*() const {
+            return valueAt(_index, std::is_integral<Arithmetic>());
         }
 
         pointer operator->() const {
-            return &_iterator;
+            return FakePointerProxy<decltype(**this)>(**this);
         }
 
-        RangeIterator& operator++() {
-            _iterator += _step;
+        constexpr RangeIterator& operator++() {
+            ++_index;
             return *this;
         }
 
-        RangeIterator operator++(int) {
+        constexpr RangeIterator operator++(int) {
             RangeIterator tmp(*this);
             ++*this;
             return tmp;
         }
 
-        RangeIterator& operator--() {
-            _iterator -= _step;
+        constexpr RangeIterator& operator--() {
+            --_index;
             return *this;
         }
 
-        RangeIterator operator--(int) {
+        constexpr RangeIterator operator--(int) {
             RangeIterator tmp(*this);
             --*this;
             return tmp;
         }
 
-        RangeIterator& operator+=(const difference_type offset) {
-            _iterator += (offset * _step);
+        constexpr RangeIterator& operator+=(const difference_type offset) {
+            _index += offset;
             return *this;
         }
 
-        RangeIterator operator+(const difference_type offset) const {
+        constexpr RangeIterator operator+(const difference_type offset) const {
             RangeIterator tmp(*this);
             return tmp += offset;
         }
 
-        RangeIterator& operator-=(const difference_type offset) {
-            _iterator -= (offset * _step);
+        constexpr RangeIterator& operator-=(const difference_type offset) {
+            _index -= offset;
             return *this;
         }
 
-        RangeIterator operator-(const difference_type other) const {
+        constexpr RangeIterator operator-(const difference_type other) const {
             RangeIterator tmp = *this;
             return tmp -= other;
         }
 
-        difference_type operator-(const RangeIterator& other) const {
-            difference_type distance = _iterator - other._iterator;
-            return static_cast<difference_type>(distance / _step);
+        constexpr difference_type operator-(const RangeIterator& other) const {
+            return _index - other._index;
         }
 
-        value_type operator[](const difference_type offset) const {
+        constexpr value_type operator[](const difference_type offset) const {
             return *(*this + offset);
         }
 
-        bool operator!=(const RangeIterator& other) const {
-            if (_step < 0) {
-                return _iterator > other._iterator;
-            }
-            return _iterator < other._iterator;
+        constexpr bool operator!=(const RangeIterator& other) const {
+            return _index != other._index;
         }
 
-        bool operator==(const RangeIterator& other) const {
+        constexpr bool operator==(const RangeIterator& other) const {
             return !(*this != other);
         }
 
-        bool operator<(const RangeIterator& other) const {
-            return _iterator < other._iterator;
+        constexpr bool operator<(const RangeIterator& other) const {
+            return _index < other._index;
         }
 
-        bool operator>(const RangeIterator& other) const {
+        constexpr bool operator>(const RangeIterator& other) const {
             return other < *this;
         }
 
-        bool operator<=(const RangeIterator& other) const {
+        constexpr bool operator<=(const RangeIterator& other) const {
             return !(other < *this);
         }
 
-        bool operator>=(const RangeIterator& other) const {
+        constexpr bool operator>=(const RangeIterator& other) const {
             return !(*this < other);
         }
     };
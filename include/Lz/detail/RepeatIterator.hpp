@@ -2,6 +2,10 @@
 
 #include <iterator>
 #include <limits>
+#include <algorithm>
+
+#include "ClosedForm.hpp"
+#include "ForEachChunk.hpp"
 
 
 namespace lz { namespace detail {
@@ -30,6 +34,27 @@ namespace lz { namespace detail {
 
         RepeatIterator() = default;
 
+        // A buffer filled with copies of the value is passed as many times as needed
+        template<class Sink, class U = T, std::enable_if_t<IsBufferable<U>::value, int> = 0>
+        friend void forEachChunk(const RepeatIterator begin, const RepeatIterator end, Sink& sink) {
+            constexpr std::size_t chunkSize = chunkSizeOf<T>();
+            T buffer[chunkSize];
+            std::size_t remaining = end._iterator - begin._iterator;
+            std::fill(buffer, buffer + (remaining < chunkSize ? remaining : chunkSize), begin._iterHelper->toRepeat);
+
+            while (remaining > 0) {
+                const std::size_t count = remaining < chunkSize ? remaining : chunkSize;
+                sink(static_cast<const T*>(buffer), count);
+                remaining -= count;
+            }
+        }
+
+        // Every element is the same number
+        template<class U = T, std::enable_if_t<std::is_arithmetic<U>::value && !std::is_same<U, bool>::value, int> = 0>
+        friend T stridedSum(const RepeatIterator first, const std::size_t count, const std::size_t /*stride*/) {
+            return static_cast<T>(first._iterHelper->toRepeat * static_cast<T>(count));
+        }
+
         reference operator*() const {
             return _iterHelper->toRepeat;
         }
@@ -5,13 +5,8 @@
 #include <iostream>
 
 #include "LzTools.hpp"
-
-
-#ifdef CXX_LT_17
-  #include <string>
-#else
-  #include <string_view>
-#endif
+#include "DelimiterScanner.hpp"
+#include "../StringView.hpp"
 
 
 namespace lz {
@@ -31,6 +26,13 @@ namespace lz {
             size_t _currentPos{}, _last{};
             mutable SubString _substring{};
             const SplitViewIteratorHelper<String>* _splitIteratorHelper{};
+            DelimiterScanner _scanner{};
+
+            size_t findDelimiter(const size_t position) {
+                const String& string = _splitIteratorHelper->string;
+                const std::string& delimiter = _splitIteratorHelper->delimiter;
+                return _scanner.find(string.data(), string.length(), delimiter.data(), delimiter.length(), position);
+            }
 
 
             friend class StringSplitter<SubString, String>;
@@ -48,19 +50,20 @@ namespace lz {
                 _splitIteratorHelper(splitIteratorHelper) {
                 // Micro optimization, check if object is created from begin(), only then we want to search
                 if (startingPosition == 0) {
-                    _last = _splitIteratorHelper->string.find(_splitIteratorHelper->delimiter, _currentPos);
+                    _last = findDelimiter(_currentPos);
                 }
             }
 
             SplitIterator() = default;
 
-            // Returns a reference to a std::string if C++14, otherwise it returns a std::string_view by value
+            // Returns a reference to a std::string if SubString is std::string, otherwise it returns the view by value
             std::conditional_t<std::is_same<SubString, std::string>::value, SubString&, SubString> operator*() const {
                 if (_last != std::string::npos) {
                     _substring = SubString(&_splitIteratorHelper->string[_currentPos], _last - _currentPos);
                 }
                 else {
-                    _substring = SubString(&_splitIteratorHelper->string[_currentPos]);
+                    _substring = SubString(&_splitIteratorHelper->string[_currentPos],
+                                           _splitIteratorHelper->string.length() - _currentPos);
                 }
                 return _substring;
             }
@@ -91,7 +94,7 @@ namespace lz {
                 }
                 else {
                     _currentPos = _last + delimLen;
-                    _last = _splitIteratorHelper->string.find(_splitIteratorHelper->delimiter, _currentPos);
+                    _last = findDelimiter(_currentPos);
                 }
 
                 return *this;
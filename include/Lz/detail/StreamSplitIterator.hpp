@@ -0,0 +1,178 @@
+#pragma once
+
+#include <istream>
+#include <string>
+
+#include "LzTools.hpp"
+
+
+namespace lz {
+    template<class, class>
+    class StreamSplitter;
+
+    namespace detail {
+        /**
+         * Reads a stream in chunks of at most `chunkSize` bytes and finds the tokens in it. The buffer holds at most the
+         * current (partial) token and one chunk: before a chunk is read, the tokens that were already handed out are removed
+         * from it. Both the chunk and the buffer are allocated with `Allocator`.
+         */
+        template<class Allocator>
+        class StreamSplitIteratorHelper {
+            using String = std::basic_string<char, std::char_traits<char>, Allocator>;
+
+            std::istream* _stream{};
+            std::string _delimiter{};
+            std::size_t _chunkSize{};
+            // A chunk is read in here and then appended to the buffer, so that reading never resizes the buffer
+            String _chunk{};
+            String _buffer{};
+            std::size_t _tokenStart{}, _tokenEnd{}, _next{};
+            bool _isLastToken{}, _isDone{};
+
+            // Waits for at least one byte, then reads what the stream buffer reports as available, so that a pipe or a terminal
+            // that delivers a line at a time yields its tokens right away instead of after a whole chunk. A stream buffer that
+            // does not know what is available, such as std::cin while it is synchronized with stdio, is read a whole chunk at a
+            // time with one blocking read, rather than a byte at a time.
+            bool readChunk() {
+                if (std::istream::traits_type::eq_int_type(_stream->peek(), std::istream::traits_type::eof())) {
+                    return false;
+                }
+
+                std::size_t read = 0;
+                while (read < _chunkSize) {
+                    const std::streamsize available = _stream->rdbuf()->in_avail();
+                    if (available <= 0 && read > 0) {
+                        break;
+                    }
+                    const auto wanted = static_cast<std::streamsize>(_chunkSize - read);
+                    _stream->read(&_chunk[read], available > 0 && available < wanted ? available : wanted);
+                    read += static_cast<std::size_t>(_stream->gcount());
+                    if (!_stream->good()) {
+                        break;
+                    }
+                }
+                _buffer.append(_chunk.data(), read);
+                return read > 0;
+            }
+
+        public:
+            StreamSplitIteratorHelper(std::istream& stream, std::string&& delimiter, const std::size_t chunkSize,
+                                      const Allocator& allocator) :
+                _stream(&stream),
+                _delimiter(std::move(delimiter)),
+                _chunkSize(chunkSize == 0 ? 1 : chunkSize),
+                _chunk(_chunkSize, '\0', allocator),
+                _buffer(allocator) {
+            }
+
+            StreamSplitIteratorHelper() = default;
+
+            void advance() {
+                if (_isLastToken) {
+                    _isDone = true;
+                    return;
+                }
+
+                _tokenStart = _next;
+                std::size_t searchFrom = _tokenStart;
+
+                while (true) {
+                    const std::size_t found = _buffer.find(_delimiter.data(), searchFrom, _delimiter.length());
+                    if (found != String::npos) {
+                        _tokenEnd = found;
+                        _next = found + _delimiter.length();
+                        return;
+                    }
+
+                    // The last delimiter length - 1 bytes may be the start of a delimiter that straddles two chunks
+                    const std::size_t delimiterLength = _delimiter.length();
+                    searchFrom = _buffer.size() - _tokenStart >= delimiterLength ? _buffer.size() - delimiterLength + 1 : _tokenStart;
+
+                    _buffer.erase(0, _tokenStart);
+                    searchFrom -= _tokenStart;
+                    _tokenStart = 0;
+
+                    if (!readChunk()) {
+                        break;
+                    }
+                }
+
+                // Like lz::split, a delimiter at the very end does not produce an empty token
+                if (_tokenStart == _buffer.size()) {
+                    _isDone = true;
+                    return;
+                }
+                _tokenEnd = _next = _buffer.size();
+                _isLastToken = true;
+            }
+
+            const char* tokenData() const {
+                return _buffer.data() + _tokenStart;
+            }
+
+            std::size_t tokenLength() const {
+                return _tokenEnd - _tokenStart;
+            }
+
+            bool isDone() const {
+                return _isDone;
+            }
+        };
+
+
+        template<class SubString, class Allocator>
+        class StreamSplitIterator {
+            mutable SubString _substring{};
+            StreamSplitIteratorHelper<Allocator>* _streamSplitIteratorHelper{};
+
+            friend class StreamSplitter<SubString, Allocator>;
+
+            bool isEnd() const {
+                return _streamSplitIteratorHelper == nullptr || _streamSplitIteratorHelper->isDone();
+            }
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = SubString;
+            using reference = std::conditional_t<std::is_same<SubString, std::string>::value, SubString&, SubString>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = FakePointerProxy<reference>;
+
+            explicit StreamSplitIterator(StreamSplitIteratorHelper<Allocator>* streamSplitIteratorHelper) :
+                _streamSplitIteratorHelper(streamSplitIteratorHelper) {
+            }
+
+            StreamSplitIterator() = default;
+
+            // Returns a reference to a std::string if SubString is std::string, otherwise a SubString by value that is valid
+            // until the iterator is incremented
+            reference operator*() const {
+                _substring = SubString(_streamSplitIteratorHelper->tokenData(), _streamSplitIteratorHelper->tokenLength());
+                return _substring;
+            }
+
+            pointer operator->() const {
+                return FakePointerProxy<decltype(**this)>(**this);
+            }
+
+            bool operator!=(const StreamSplitIterator& other) const {
+                return isEnd() != other.isEnd();
+            }
+
+            bool operator==(const StreamSplitIterator& other) const {
+                return !(*this != other);
+            }
+
+            StreamSplitIterator& operator++() {
+                _streamSplitIteratorHelper->advance();
+                return *this;
+            }
+
+            StreamSplitIterator operator++(int) {
+                StreamSplitIterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+        };
+    }
+}
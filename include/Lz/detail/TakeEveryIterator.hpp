@@ -2,6 +2,8 @@
 
 #include <iterator>
 
+#include "ClosedForm.hpp"
+
 
 namespace lz {
     template<class>
@@ -11,8 +13,8 @@ namespace lz {
 
     template<class Iterator>
     class TakeEveryIterator {
+        // The end is not stored, the iterator is at its end when `_current` reaches `_distance`
         Iterator _iterator{};
-        Iterator _end{};
         size_t _offset{};
         size_t _current{};
         size_t _distance{};
@@ -30,7 +32,6 @@ namespace lz {
 
         TakeEveryIterator(const Iterator iterator, const Iterator end, const size_t offset, const size_t distance) :
             _iterator(iterator),
-            _end(end),
             _offset(offset),
             _current(iterator == end ? distance : 0),
             _distance(distance) {
@@ -38,6 +39,12 @@ namespace lz {
 
         TakeEveryIterator() = default;
 
+        // Every element is `_offset` elements of the underlying sequence further
+        template<class I = Iterator, std::enable_if_t<HasStridedSum<I>::value, int> = 0>
+        friend ValueType<Iterator> stridedSum(const TakeEveryIterator first, const std::size_t count, const std::size_t stride) {
+            return stridedSum(first._iterator, count, stride * first._offset);
+        }
+
         reference operator*() const {
             return *_iterator;
         }
@@ -72,7 +79,8 @@ namespace lz {
             auto total = static_cast<size_t>(_offset * offset);
 
             if (_current + total >= _distance) {
-                _iterator = _end;
+                _iterator = std::next(_iterator, static_cast<difference_type>(_distance - _current));
+                _current = _distance;
             }
             else {
                 _iterator = std::next(_iterator, total);
@@ -85,7 +93,8 @@ namespace lz {
             auto total = _offset * offset;
 
             if (static_cast<std::ptrdiff_t>(_current - total) < 0) {
-                _iterator = _end;
+                _iterator = std::next(_iterator, static_cast<difference_type>(_distance - _current));
+                _current = _distance;
             }
             else {
                 _iterator = std::prev(_iterator, total);
@@ -107,9 +116,10 @@ namespace lz {
         }
 
         difference_type operator-(const TakeEveryIterator& other) const {
-            difference_type distance = std::distance(other._iterator, _iterator);
-            auto diffOffset = static_cast<difference_type>(distance / _offset);
-            return _offset % 2 == 0 ? diffOffset : diffOffset + 1;
+            // The last element that is taken may be less than `_offset` elements before the end
+            const difference_type distance = std::distance(other._iterator, _iterator);
+            const auto offset = static_cast<difference_type>(_offset);
+            return distance < 0 ? -((offset - 1 - distance) / offset) : (distance + offset - 1) / offset;
         }
 
         reference operator[](const difference_type offset) const {
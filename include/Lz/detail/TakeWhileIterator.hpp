@@ -0,0 +1,170 @@
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    template<class Iterator, class Function>
+    class TakeWhileIterator {
+        using IterTraits = std::iterator_traits<Iterator>;
+
+    public:
+        using value_type = typename IterTraits::value_type;
+        using iterator_category = typename IterTraits::iterator_category;
+        using difference_type = typename IterTraits::difference_type;
+        using reference = typename IterTraits::reference;
+        using pointer = std::conditional_t<IsComputed<Iterator>::value, FakePointerProxy<reference>, typename IterTraits::pointer>;
+
+    private:
+        struct NoValue {
+        };
+
+        // The computed value that the predicate was called with, e.g. of a Map, until the iterator moves
+        using Cache = std::conditional_t<IsComputed<Iterator>::value, CachedValue<std::remove_cv_t<reference>>, NoValue>;
+
+        Iterator _iterator{};
+        FunctionContainer<Function> _function{};
+        mutable Cache _cache{};
+
+        reference current(std::false_type /*isComputed*/) const {
+            return *_iterator;
+        }
+
+        reference current(std::true_type /*isComputed*/) const {
+            if (!_cache.hasValue()) {
+                _cache.emplace(*_iterator);
+            }
+            return _cache.get();
+        }
+
+        reference current() const {
+            return current(IsComputed<Iterator>());
+        }
+
+        pointer arrow(std::false_type /*isComputed*/) const {
+            return &*_iterator;
+        }
+
+        pointer arrow(std::true_type /*isComputed*/) const {
+            return FakePointerProxy<reference>(current());
+        }
+
+        static void forget(NoValue& /*cache*/) {
+        }
+
+        template<class T>
+        static void forget(CachedValue<T>& cache) {
+            cache.reset();
+        }
+
+        void moved() {
+            forget(_cache);
+        }
+
+    public:
+        TakeWhileIterator(const Iterator iterator, const Iterator end, const FunctionContainer<Function>& function) :
+            _iterator(iterator),
+            _function(function) {
+            if (iterator != end && !_function(current())) {
+                _iterator = end;
+                moved();
+            }
+        }
+
+        TakeWhileIterator() = default;
+
+        reference operator*() const {
+            return current();
+        }
+
+        pointer operator->() const {
+            return arrow(IsComputed<Iterator>());
+        }
+
+        TakeWhileIterator& operator++() {
+            ++_iterator;
+            moved();
+            return *this;
+        }
+
+        TakeWhileIterator operator++(int) {
+            TakeWhileIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        TakeWhileIterator& operator--() {
+            --_iterator;
+            moved();
+            return *this;
+        }
+
+        TakeWhileIterator operator--(int) {
+            TakeWhileIterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        TakeWhileIterator& operator+=(const difference_type offset) {
+            _iterator += offset;
+            moved();
+            return *this;
+        }
+
+        TakeWhileIterator& operator-=(const difference_type offset) {
+            _iterator -= offset;
+            moved();
+            return *this;
+        }
+
+        TakeWhileIterator operator+(const difference_type offset) const {
+            TakeWhileIterator tmp(*this);
+            tmp += offset;
+            return tmp;
+        }
+
+        TakeWhileIterator operator-(const difference_type offset) const {
+            TakeWhileIterator tmp(*this);
+            tmp -= offset;
+            return tmp;
+        }
+
+        difference_type operator-(const TakeWhileIterator& other) const {
+            return _iterator - other._iterator;
+        }
+
+        reference operator[](const difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        bool operator!=(const TakeWhileIterator& other) const {
+            if (_iterator == other._iterator) {
+                return false;
+            }
+            return _function(current());
+        }
+
+        bool operator==(const TakeWhileIterator& other) const {
+            return _iterator == other._iterator;
+        }
+
+        bool operator<(const TakeWhileIterator& other) const {
+            return _iterator < other._iterator;
+        }
+
+        bool operator>(const TakeWhileIterator& other) const {
+            return other < *this;
+        }
+
+        bool operator<=(const TakeWhileIterator& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>=(const TakeWhileIterator& other) const {
+            return !(*this < other);
+        }
+    };
+}}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "FlatHashSet.hpp"
+#include "LzTools.hpp"
+
+
+namespace lz { namespace detail {
+    /**
+     * The values that were seen are shared by all copies of an iterator, so that copying an iterator, as algorithms and
+     * postfix increments do, does not copy the set. Incrementing one copy therefore affects the others, which makes this an
+     * input iterator. Every call to `begin()` of the view starts with a new set.
+     */
+    template<class Iterator, class Hash, class KeyEqual, class Allocator>
+    class UniqueHashedIterator {
+    private:
+        using IterTraits = std::iterator_traits<Iterator>;
+        using Set = FlatHashSet<typename IterTraits::value_type, Hash, KeyEqual, Allocator>;
+
+        Iterator _iterator{};
+        SentinelOf<Iterator> _end{};
+        std::shared_ptr<Set> _seen{};
+
+        static constexpr std::size_t MaxInitialReserve = 1024;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename IterTraits::value_type;
+        using difference_type = typename IterTraits::difference_type;
+        using pointer = typename IterTraits::pointer;
+        using reference = typename IterTraits::reference;
+
+        UniqueHashedIterator(const Iterator begin, const Iterator end, const Hash& hash, const KeyEqual& keyEqual,
+                             const Allocator& allocator) :
+            _iterator(begin),
+            _end(sentinelOf(end)) {
+            if (begin == end) {
+                return;
+            }
+            _seen = std::allocate_shared<Set>(allocator, hash, keyEqual, allocator);
+
+            // Short sequences get all their memory at once, long ones may contain far fewer unique values than elements
+            const SizeHint hint = sizeHintOf(begin, end);
+            if (hint.isKnown()) {
+                _seen->reserve(hint.size < MaxInitialReserve ? hint.size : MaxInitialReserve);
+            }
+            _seen->insert(*_iterator);
+        }
+
+        UniqueHashedIterator() = default;
+
+        friend SentinelOf<Iterator> sentinelOf(const UniqueHashedIterator& end) {
+            return end._end;
+        }
+
+        friend bool reachedEnd(const UniqueHashedIterator& iterator, const SentinelOf<Iterator>& end) {
+            return reachedEnd(iterator._iterator, end);
+        }
+
+        reference operator*() const {
+            return *_iterator;
+        }
+
+        pointer operator->() const {
+            return &*_iterator;
+        }
+
+        UniqueHashedIterator& operator++() {
+            for (++_iterator; !reachedEnd(_iterator, _end); ++_iterator) {
+                if (_seen->insert(*_iterator)) {
+                    break;
+                }
+            }
+            return *this;
+        }
+
+        UniqueHashedIterator operator++(int) {
+            UniqueHashedIterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator!=(const UniqueHashedIterator& other) const {
+            return _iterator != other._iterator;
+        }
+
+        bool operator==(const UniqueHashedIterator& other) const {
+            return !(*this != other);
+        }
+    };
+}}
@@ -3,6 +3,8 @@
 #include <iterator>
 #include <algorithm>
 
+#include "LzTools.hpp"
+
 
 namespace lz { namespace detail {
     template<class Iterator>
@@ -11,7 +13,7 @@ namespace lz { namespace detail {
         using IterTraits = std::iterator_traits<Iterator>;
 
         Iterator _iterator{};
-        Iterator _end{};
+        SentinelOf<Iterator> _end{};
 
     public:
         using iterator_category = std::forward_iterator_tag;
@@ -22,7 +24,7 @@ namespace lz { namespace detail {
 
         UniqueIterator(const Iterator begin, const Iterator end):
             _iterator(begin),
-            _end(end) {
+            _end(sentinelOf(end)) {
             if (begin == end) {
                 return;
             }
@@ -36,6 +38,14 @@ namespace lz { namespace detail {
 
         UniqueIterator() = default;
 
+        friend SentinelOf<Iterator> sentinelOf(const UniqueIterator& end) {
+            return end._end;
+        }
+
+        friend bool reachedEnd(const UniqueIterator& iterator, const SentinelOf<Iterator>& end) {
+            return reachedEnd(iterator._iterator, end);
+        }
+
         reference operator*() const {
             return *_iterator;
         }
@@ -45,9 +55,13 @@ namespace lz { namespace detail {
         }
 
         UniqueIterator& operator++() {
-            _iterator = std::adjacent_find(_iterator, _end, std::less<value_type>());
-            if (_iterator != _end) {
-                ++_iterator;
+            if (reachedEnd(_iterator, _end)) {
+                return *this;
+            }
+            // The sequence is sorted, so the next unique value is the first one that is greater than its predecessor
+            Iterator previous = _iterator;
+            for (++_iterator; !reachedEnd(_iterator, _end) && !(*previous < *_iterator); ++_iterator) {
+                previous = _iterator;
             }
             return *this;
         }
@@ -0,0 +1,97 @@
+#include <Lz/Arena.hpp>
+#include <Lz/Range.hpp>
+#include <Lz/Map.hpp>
+#include <list>
+#include <catch.hpp>
+
+
+TEST_CASE("Arena allocating memory", "[Arena][Basic functionality]") {
+    lz::Arena arena(64);
+
+    SECTION("Should align allocations") {
+        arena.allocate(1, 1);
+        void* pointer = arena.allocate(8, 8);
+        CHECK(reinterpret_cast<std::uintptr_t>(pointer) % 8 == 0);
+        pointer = arena.allocate(16, 32);
+        CHECK(reinterpret_cast<std::uintptr_t>(pointer) % 32 == 0);
+    }
+
+    SECTION("Should grow past its block size") {
+        char* large = static_cast<char*>(arena.allocate(1000, 1));
+        std::fill(large, large + 1000, 'a');
+        char* next = static_cast<char*>(arena.allocate(10, 1));
+        CHECK((next < large || next >= large + 1000));
+        arena.release();
+    }
+
+    SECTION("Should use its buffer first") {
+        alignas(std::max_align_t) char buffer[256];
+        lz::Arena bufferArena(buffer, sizeof buffer);
+        char* pointer = static_cast<char*>(bufferArena.allocate(100, 1));
+        CHECK((pointer >= buffer && pointer + 100 <= buffer + sizeof buffer));
+        CHECK(static_cast<char*>(bufferArena.allocate(1000, 1)) != nullptr);
+
+        bufferArena.release();
+        CHECK(bufferArena.allocate(1, 1) == buffer);
+    }
+
+    SECTION("Should not align past the end of a misaligned buffer") {
+        alignas(16) char buffer[32];
+        lz::Arena bufferArena(buffer + 1, 8);
+        char* pointer = static_cast<char*>(bufferArena.allocate(4, 16));
+        CHECK(reinterpret_cast<std::uintptr_t>(pointer) % 16 == 0);
+        CHECK((pointer < buffer || pointer >= buffer + sizeof buffer));
+    }
+
+    SECTION("Should not align past the end of a block") {
+        lz::Arena smallArena(24);
+        char* first = static_cast<char*>(smallArena.allocate(20, 1));
+        std::fill(first, first + 20, 'a');
+        char* second = static_cast<char*>(smallArena.allocate(8, 16));
+        CHECK(reinterpret_cast<std::uintptr_t>(second) % 16 == 0);
+        CHECK((second + 8 <= first || second >= first + 24));
+        std::fill(second, second + 8, 'b');
+    }
+}
+
+TEST_CASE("Arena to containers", "[Arena][To container]") {
+    lz::Arena arena;
+    auto squares = lz::map(lz::range(5), [](const int i) { return i * i; });
+
+    SECTION("To vector") {
+        std::vector<int, lz::ArenaAllocator<int>> vector = squares.toVector(arena.allocator<int>());
+        CHECK(vector == std::vector<int, lz::ArenaAllocator<int>>({0, 1, 4, 9, 16}, arena));
+        CHECK(&vector.get_allocator().arena() == &arena);
+    }
+
+    SECTION("To other container using to<>()") {
+        std::list<int, lz::ArenaAllocator<int>> list = squares.to<std::list>(arena.allocator<int>());
+        CHECK(list == std::list<int, lz::ArenaAllocator<int>>({0, 1, 4, 9, 16}, arena));
+    }
+
+    SECTION("To map and unordered map") {
+        auto key = [](const int i) { return i % 2; };
+        using Pair = std::pair<const int, int>;
+        auto map = squares.toMap<decltype(key), std::less<int>>(key, lz::ArenaAllocator<Pair>(arena));
+        auto unorderedMap = squares.toUnorderedMap<decltype(key), std::hash<int>, std::equal_to<int>>(key, lz::ArenaAllocator<Pair>(arena));
+        CHECK(&map.get_allocator().arena() == &arena);
+        CHECK(&unorderedMap.get_allocator().arena() == &arena);
+        CHECK(map.at(1) == 1);
+        CHECK(unorderedMap.at(0) == 0);
+    }
+
+    SECTION("To string") {
+        auto string = lz::range(4).toString(" ", arena.allocator<char>());
+        static_assert(std::is_same<decltype(string), std::basic_string<char, std::char_traits<char>, lz::ArenaAllocator<char>>>::value,
+                      "the string must use the allocator");
+        CHECK(string.c_str() == std::string("0 1 2 3"));
+    }
+
+#ifdef LZ_HAS_MEMORY_RESOURCE
+    SECTION("As memory resource") {
+        std::pmr::vector<int> vector = squares.toVector(std::pmr::polymorphic_allocator<int>(&arena));
+        CHECK(vector.get_allocator().resource() == &arena);
+        CHECK(vector == std::pmr::vector<int>({0, 1, 4, 9, 16}));
+    }
+#endif
+}
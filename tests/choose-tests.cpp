@@ -44,6 +44,7 @@ TEST_CASE("Choose binary operations", "[Choose][Binary ops]") {
         CHECK(iterator != chooser.end());
         iterator = chooser.end();
         CHECK(iterator == chooser.end());
+        CHECK(chooser.begin() != std::next(chooser.begin()));
     }
 }
 
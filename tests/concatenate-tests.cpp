@@ -1,7 +1,9 @@
 #include <catch.hpp>
 
 #include <Lz/Concatenate.hpp>
+#include <Lz/FunctionTools.hpp>
 #include <list>
+#include <functional>
 
 
 TEST_CASE("Concat changing and creating elements", "[Concat][Basic functionality]") {
@@ -130,4 +132,70 @@ TEST_CASE("Concatenate to containers", "[Concatenate][To container]") {
         };
         CHECK(map == expected);
     }
-}
\ No newline at end of file
+
+    SECTION("To unordered map with hasher") {
+        struct Hasher {
+            std::size_t operator()(const int i) const {
+                return static_cast<std::size_t>(i) * 31;
+            }
+        };
+        auto map = concat.toUnorderedMap<std::function<int(int)>, Hasher>([](const int i) { return i % 2; });
+        static_assert(std::is_same<decltype(map), std::unordered_map<int, int, Hasher>>::value, "hasher must be kept");
+        CHECK(map.size() == 2);
+        CHECK(map[1] == 1);
+        CHECK(map[0] == 2);
+    }
+}
+TEST_CASE("Concatenate with empty sequences", "[Concatenate][Segments]") {
+    std::vector<int> empty;
+    std::vector<int> v1 = {1, 2};
+    std::vector<int> v2 = {3};
+    std::vector<int> v3 = {4, 5, 6};
+    auto concat = lz::concat(empty, v1, empty, empty, v2, v3, empty);
+
+    SECTION("Should skip empty sequences") {
+        CHECK(concat.toVector() == std::vector<int>{1, 2, 3, 4, 5, 6});
+        CHECK(concat.to<std::list>() == std::list<int>{1, 2, 3, 4, 5, 6});
+        CHECK(concat.toArray<6>() == std::array<int, 6>{1, 2, 3, 4, 5, 6});
+        CHECK(lz::concat(empty, empty).toVector().empty());
+    }
+
+    SECTION("Operator-- over multiple sequences") {
+        auto end = concat.end();
+        std::vector<int> reversed;
+        for (auto it = concat.end(); it != concat.begin();) {
+            reversed.push_back(*--it);
+        }
+        CHECK(reversed == std::vector<int>{6, 5, 4, 3, 2, 1});
+
+        auto tmp = end--;
+        CHECK(tmp == concat.end());
+        CHECK(*end == 6);
+    }
+
+    SECTION("Operator+= and operator-= over multiple sequences") {
+        auto begin = concat.begin();
+        for (std::ptrdiff_t i = 0; i < 6; i++) {
+            CHECK(*(begin + i) == i + 1);
+            CHECK(*(concat.end() - (6 - i)) == i + 1);
+        }
+        CHECK(begin + 6 == concat.end());
+        CHECK(concat.end() - 6 == begin);
+
+        begin += 5;
+        begin -= 3;
+        CHECK(*begin == 3);
+        begin += -2;
+        CHECK(*begin == 1);
+        CHECK(concat.end() - begin == 6);
+    }
+
+    SECTION("Should pass every sequence to forEachSegment") {
+        std::vector<std::size_t> sizes;
+        lz::forEachSegment(lz::concat(concat, v2), [&sizes](std::vector<int>::iterator first, std::vector<int>::iterator last) {
+            sizes.push_back(static_cast<std::size_t>(std::distance(first, last)));
+        });
+        CHECK(sizes == std::vector<std::size_t>{0, 2, 0, 0, 1, 3, 0, 1});
+        CHECK(lz::transaccumulate(concat, 0, [](const int i) { return i; }) == 21);
+    }
+}
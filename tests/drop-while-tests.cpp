@@ -19,6 +19,16 @@ TEST_CASE("DropWhile changing and creating elements", "[DropWhile][Basic functio
         CHECK(arr[2] == 0);
     }
 
+    SECTION("Should expose contiguous storage") {
+        std::string string = "   trimmed";
+        auto trimmed = lz::dropwhile(string, [](const char c) { return c == ' '; });
+
+        CHECK(trimmed.data() == string.data() + 3);
+        CHECK(trimmed.size() == 7);
+        CHECK(std::string(trimmed.data(), trimmed.size()) == "trimmed");
+        CHECK(lz::dropwhile(string, [](const char) { return true; }).data() == nullptr);
+    }
+
     SECTION("Should not drop last element") {
         ++begin;
         CHECK(*begin == 1);
@@ -1,6 +1,8 @@
+#include <Lz/Arena.hpp>
 #include <Lz/Except.hpp>
 #include <Lz/Range.hpp>
 #include <list>
+#include <sstream>
 
 #include <catch.hpp>
 #include <iostream>
@@ -37,6 +39,74 @@ TEST_CASE("Except excepts elements and is by reference", "[Except][Basic functio
     }
 }
 
+TEST_CASE("Except unsorted and large sequences", "[Except][Edge cases]") {
+    SECTION("Does not sort or modify the sequences") {
+        std::vector<int> array{5, 1, 4, 2, 3};
+        std::vector<int> toExcept{4, 1};
+
+        CHECK(lz::except(array, toExcept).toVector() == std::vector<int>{5, 2, 3});
+        CHECK(array == std::vector<int>{5, 1, 4, 2, 3});
+        CHECK(toExcept == std::vector<int>{4, 1});
+    }
+
+    SECTION("Large exclusion ranges") {
+        std::vector<int> sparse;
+        std::vector<int> dense;
+        for (int i = 0; i < 1000; i++) {
+            sparse.push_back(i * 104729);
+            dense.push_back(999 - i);
+        }
+        std::vector<int> array = {-1, 0, 104729, 104730, 999, 1000};
+
+        CHECK(lz::except(array, sparse).toVector() == std::vector<int>{-1, 104730, 999, 1000});
+        CHECK(lz::except(array, dense).toVector() == std::vector<int>{-1, 104729, 104730, 1000});
+    }
+
+    SECTION("Strings") {
+        std::vector<std::string> array = {"a", "b", "c", "d"};
+        std::list<std::string> toExcept = {"d", "b"};
+        CHECK(lz::except(array, toExcept).toVector() == std::vector<std::string>{"a", "c"});
+    }
+
+    SECTION("Reads the exclusion range once") {
+        std::vector<int> array = {1, 2, 3, 4};
+        std::istringstream stream("3 1");
+        auto except = lz::exceptrange(array.begin(), array.end(), std::istream_iterator<int>(stream),
+                                      std::istream_iterator<int>());
+        auto first = except.begin();
+        CHECK(except.toVector() == std::vector<int>{2, 4});
+        CHECK(except.toVector() == std::vector<int>{2, 4});
+        CHECK(*++first == 4);
+    }
+}
+
+TEST_CASE("Except with an allocator", "[Except][Basic functionality]") {
+    alignas(std::max_align_t) char buffer[1 << 14];
+    lz::Arena arena(buffer, sizeof buffer);
+    char* const first = static_cast<char*>(arena.allocate(1, 1));
+
+    SECTION("Should put the bitset in the arena") {
+        std::vector<int> values = lz::range(100).toVector();
+        std::vector<int> toExcept = lz::range(0, 100, 2).toVector();
+        auto except = lz::except(values, toExcept, lz::ArenaAllocator<int>(arena));
+        CHECK(except.toVector() == lz::range(1, 100, 2).toVector());
+    }
+
+    SECTION("Should put the hash set in the arena") {
+        std::vector<std::string> values;
+        for (int i = 0; i < 100; i++) {
+            values.push_back(std::to_string(i));
+        }
+        std::vector<std::string> toExcept(values.begin() + 1, values.end());
+        auto except = lz::except(values, toExcept, lz::ArenaAllocator<std::string>(arena));
+        CHECK(except.toVector() == std::vector<std::string>{"0"});
+    }
+
+    char* const next = static_cast<char*>(arena.allocate(1, 1));
+    CHECK(next - first > 1);
+    CHECK(next - buffer < static_cast<std::ptrdiff_t>(sizeof buffer));
+}
+
 TEST_CASE("Except binary operations", "[Except][Binary ops]") {
     std::vector<int> a = {1, 2, 3, 4};
     std::vector<int> b = {2, 3};
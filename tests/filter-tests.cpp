@@ -2,7 +2,12 @@
 
 #include <catch.hpp>
 
+#include <Lz/Except.hpp>
 #include <Lz/Filter.hpp>
+#include <Lz/Generate.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/TakeEvery.hpp>
+#include <Lz/UniqueHashed.hpp>
 
 
 TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]") {
@@ -31,6 +36,34 @@ TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]")
         *it = 50;
         CHECK(array[0] == 50);
     }
+
+    SECTION("Should compute every mapped value once") {
+        int calls = 0;
+        auto mapped = lz::map(array, [&calls](const int i) {
+            ++calls;
+            return i * 10;
+        });
+        auto filter = lz::filter(mapped, [](const int i) { return i != 20; });
+
+        std::vector<int> actual;
+        for (const int i : filter) {
+            actual.push_back(i);
+        }
+        CHECK(actual == std::vector<int>{10, 30});
+        CHECK(calls == 3);
+    }
+
+    SECTION("Should yield the generated value that satisfied the predicate") {
+        int counter = 0;
+        auto generated = lz::generate([&counter]() { return counter++; }, 6);
+        auto filter = lz::filter(generated, [](const int i) { return i % 2 == 0; });
+
+        std::vector<int> actual;
+        for (const int i : filter) {
+            actual.push_back(i);
+        }
+        CHECK(actual == std::vector<int>{0, 2, 4});
+    }
 }
 
 
@@ -50,10 +83,55 @@ TEST_CASE("Filter binary operations", "[Filter][Binary ops]") {
         CHECK(it != filter.end());
         it = filter.end();
         CHECK(it == filter.end());
+        CHECK(filter.begin() != std::next(filter.begin()));
+        CHECK(std::distance(filter.begin(), std::next(filter.begin())) == 1);
     }
 }
 
 
+TEST_CASE("Nested filter iterators store one end", "[Filter][Sentinel]") {
+    std::vector<int> vec{1, 2, 3, 4, 5, 6};
+    auto isOdd = [](const int i) { return i % 2 != 0; };
+    auto notThree = [](const int i) { return i != 3; };
+
+    auto one = lz::filter(vec, isOdd);
+    auto two = lz::filter(one, notThree);
+    auto three = lz::filter(two, notThree);
+    auto mapped = lz::filter(lz::map(two, [](const int i) { return i * 2; }), notThree);
+
+    // Every stage adds its own end and predicate, rather than a copy of the whole iterator below it
+    CHECK(sizeof(three.begin()) - sizeof(two.begin()) == sizeof(two.begin()) - sizeof(one.begin()));
+    CHECK(sizeof(mapped.begin()) < 2 * sizeof(two.begin()));
+
+    CHECK(two.toVector() == std::vector<int>{1, 5});
+    CHECK(three.toVector() == std::vector<int>{1, 5});
+    CHECK(mapped.toVector() == std::vector<int>{2, 10});
+}
+
+TEST_CASE("Mixed pipelines store one end", "[Filter][Sentinel]") {
+    std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<int> toExcept{9, 21};
+    constexpr std::size_t word = sizeof(std::vector<int>::iterator);
+
+    auto filtered = lz::filter(vec, [](const int i) { return i % 2 != 0; });
+    auto mapped = lz::map(filtered, [](const int i) { return i * 3; });
+    auto excepted = lz::except(mapped, toExcept);
+    auto unique = lz::uniqueHashed(excepted);
+    auto threes = lz::map(vec, [](const int i) { return i * 3; });
+    auto every = lz::takeevery(threes, 2);
+
+    // A filter iterator is its iterator, its end and its (empty) predicate, every next stage only adds its own state
+    CHECK(sizeof(filtered.begin()) == 3 * word);
+    CHECK(sizeof(mapped.begin()) == 4 * word);
+    CHECK(sizeof(excepted.begin()) == 5 * word);
+    CHECK(sizeof(unique.begin()) == sizeof(excepted.begin()) + word + sizeof(std::shared_ptr<int>));
+    CHECK(sizeof(every.begin()) == sizeof(threes.begin()) + 3 * word);
+
+    CHECK(unique.toVector() == std::vector<int>{3, 15, 27});
+    CHECK(every.toVector() == std::vector<int>{3, 9, 15, 21, 27});
+}
+
+
 TEST_CASE("Filter to container", "[Filter][To container]") {
     constexpr size_t size = 3;
     std::array<int, size> array{1, 2, 3};
@@ -78,6 +156,24 @@ TEST_CASE("Filter to container", "[Filter][To container]") {
         CHECK(filteredVec[1] == array[1]);
     }
 
+    SECTION("Size hint is an upper bound") {
+        auto filter = lz::filter(array, [](int i) { return i != 3; });
+        lz::detail::SizeHint hint = filter.sizeHint();
+
+        CHECK(hint.kind == lz::detail::SizeHintKind::UpperBound);
+        CHECK(hint.size == size);
+        CHECK(filter.toVector().capacity() == size);
+
+        std::vector<int> large(100000);
+        std::vector<int> none = lz::filter(large, [](const int i) { return i != 0; }).toVector();
+        CHECK(none.empty());
+        CHECK(none.capacity() <= lz::detail::MaxUpperBoundReserve);
+
+        std::string noneString = lz::filter(large, [](const int i) { return i != 0; }).toString(" ");
+        CHECK(noneString.empty());
+        CHECK(noneString.capacity() <= lz::detail::MaxUpperBoundReserve * (lz::detail::maxFormattedSize<int>() + 1));
+    }
+
     SECTION("To other container using to<>()") {
         auto filteredList = lz::filter(array, [](int i) {
             return i != 3;
@@ -0,0 +1,75 @@
+#include <Lz/Range.hpp>
+#include <functional>
+#include <string>
+#include <catch.hpp>
+
+
+TEST_CASE("FlatHashMap changing and creating elements", "[FlatHashMap][Basic functionality]") {
+    auto range = lz::range(1, 7);
+
+    SECTION("To flat map") {
+        auto map = range.toFlatMap([](const int i) { return i % 3; });
+        REQUIRE(map.size() == 3);
+        CHECK(map.at(1) == 1);
+        CHECK(map.at(2) == 2);
+        CHECK(map.at(0) == 3);
+        CHECK(map.find(3) == map.end());
+        CHECK_THROWS_AS(map.at(3), std::out_of_range);
+        CHECK(map.begin()->first == 1);
+    }
+
+    SECTION("Duplicate policies") {
+        lz::FlatHashMap<int, int> expected;
+        expected.insert(std::make_pair(0, 6));
+        expected.insert(std::make_pair(1, 4));
+        expected.insert(std::make_pair(2, 5));
+        CHECK(range.toFlatMap([](const int i) { return i % 3; }, lz::KeepLast()) == expected);
+
+        auto sums = range.toFlatMap([](const int i) { return i % 3; }, std::plus<int>());
+        CHECK(sums.at(0) == 9);
+        CHECK(sums.at(1) == 5);
+        CHECK(sums.at(2) == 7);
+        sums[3] += 1;
+        CHECK(sums.at(3) == 1);
+    }
+}
+
+TEST_CASE("FlatHashMap copy and move", "[FlatHashMap][Copy and move]") {
+    lz::FlatHashMap<std::string, int> map;
+    map["a"] = 1;
+    map["b"] = 2;
+
+    SECTION("Copy construction") {
+        lz::FlatHashMap<std::string, int> copy(map);
+        copy["c"] = 3;
+        CHECK(copy.size() == 3);
+        CHECK(copy.at("a") == 1);
+        CHECK(map.size() == 2);
+        CHECK(!map.contains("c"));
+    }
+
+    SECTION("Copy assignment") {
+        lz::FlatHashMap<std::string, int> copy;
+        copy["z"] = 26;
+        copy = map;
+        CHECK(copy == map);
+        CHECK(!copy.contains("z"));
+
+        copy["a"] = 10;
+        CHECK(map.at("a") == 1);
+
+        auto grouped = lz::range(10).toFlatMap([](const int i) { return std::to_string(i % 2); });
+        grouped = lz::range(3).toFlatMap([](const int i) { return std::to_string(i); });
+        CHECK(grouped.size() == 3);
+    }
+
+    SECTION("Move assignment") {
+        lz::FlatHashMap<std::string, int> moved;
+        moved["z"] = 26;
+        lz::FlatHashMap<std::string, int> copy(map);
+        moved = std::move(copy);
+        CHECK(moved == map);
+        CHECK(!moved.contains("z"));
+        CHECK(moved.find("b")->second == 2);
+    }
+}
@@ -1,5 +1,17 @@
 #include <Lz/FunctionTools.hpp>
 #include <Lz/Range.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Concatenate.hpp>
+#include <Lz/Repeat.hpp>
+#include <Lz/Take.hpp>
+#include <Lz/TakeEvery.hpp>
+#include <Lz/Zip.hpp>
+#include <list>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
 #include <catch.hpp>
 
 
@@ -12,6 +24,36 @@ TEST_CASE("Function tools") {
         CHECK(avg == Approx((1. + 2. + 3. + 4.) / 4.));
     }
 
+    SECTION("Sum") {
+        CHECK(lz::sum(ints) == 10);
+        CHECK(lz::sum(doubles) == Approx(1.2 + 2.5 + 3.3 + 4.5));
+        CHECK(lz::sum(lz::par, ints) == 10);
+    }
+
+    SECTION("Closed form sums") {
+        CHECK(lz::sum(lz::range(1, 101)) == 5050);
+        CHECK(lz::sum(lz::range(0, 10, 3)) == 18);
+        CHECK(lz::sum(lz::range(0, 9, 2)) == 20);
+        CHECK(lz::sum(lz::range(10, 0, -3)) == 22);
+        CHECK(lz::sum(lz::range(0)) == 0);
+        CHECK(lz::sum(lz::range(0., 1., .25)) == Approx(1.5));
+        CHECK(lz::mean(lz::range(1, 101)) == Approx(50.5));
+
+        // Adding these one by one would take seconds
+        CHECK(lz::sum(lz::range<long long>(1000000000LL)) == 499999999500000000LL);
+        CHECK(lz::sum(lz::par, lz::range<long long>(1000000000LL)) == 499999999500000000LL);
+
+        CHECK(lz::sum(lz::repeat(3, 4)) == 12);
+        CHECK(lz::mean(lz::repeat(2.5, 4)) == Approx(2.5));
+
+        CHECK(lz::sum(lz::take(lz::range(1, 101), 10)) == 55);
+        CHECK(lz::sum(lz::slice(lz::range(100), 10, 20)) == 145);
+        CHECK(lz::sum(lz::takeevery(lz::range(10), 3)) == 18);
+        CHECK(lz::sum(lz::takeevery(lz::range(9), 3)) == 9);
+        CHECK(lz::mean(lz::takeevery(lz::range(9), 3)) == Approx(3.));
+        CHECK(lz::sum(lz::takeevery(lz::repeat(2, 7), 2)) == 8);
+    }
+
     SECTION("Median") {
         double median = lz::median(std::vector<int>(ints));
         CHECK(median == Approx((2 + 3) / 2.));
@@ -33,7 +75,8 @@ TEST_CASE("Function tools") {
     SECTION("Lines") {
         std::string string = "aa\nbb\nbb";
         auto lines = lz::lines(string).toVector();
-        CHECK(lines == std::vector<std::string>{"aa", "bb", "bb"});
+        CHECK(lines == std::vector<lz::StringView>{"aa", "bb", "bb"});
+        CHECK(lz::lines<std::string>(string).toVector() == std::vector<std::string>{"aa", "bb", "bb"});
     }
 
     SECTION("Transform accumulate") {
@@ -43,4 +86,108 @@ TEST_CASE("Function tools") {
         }, std::plus<>());
         CHECK(totalSize == 11);
     }
+
+    SECTION("Parallel reductions") {
+        constexpr lz::ParallelPolicy policy(4, 10);
+        std::vector<long long> values = lz::range<long long>(1, 1001).toVector();
+
+        CHECK(lz::mean(policy, values) == Approx(500.5));
+        CHECK(lz::mean(policy, ints) == Approx((1. + 2. + 3. + 4.) / 4.));
+
+        long long sumOfSquares = lz::transaccumulate(policy, values, 0LL, [](const long long i) {
+            return i * i;
+        });
+        CHECK(sumOfSquares == 333833500LL);
+
+        std::vector<std::string> s = {"hello", "world", "!"};
+        size_t totalSize = lz::transaccumulate(lz::par, s, static_cast<size_t>(0), [](const std::string& s) {
+            return s.size();
+        }, std::plus<>());
+        CHECK(totalSize == 11);
+    }
+
+    SECTION("Parallel reductions reuse their threads") {
+        constexpr lz::ParallelPolicy policy(64, 1);
+        std::vector<long long> values = lz::range<long long>(1, 1001).toVector();
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+
+        for (int i = 0; i < 10; i++) {
+            long long sum = lz::transaccumulate(policy, values, 0LL, [&mutex, &threads](const long long value) {
+                std::lock_guard<std::mutex> lock(mutex);
+                threads.insert(std::this_thread::get_id());
+                return value;
+            });
+            CHECK(sum == 500500LL);
+        }
+        CHECK(threads.size() <= std::max(std::thread::hardware_concurrency(), 1u));
+
+        // Chunks that wait for chunks of their own run queued chunks instead of blocking the pool
+        long long nested = lz::transaccumulate(policy, values, 0LL, [&values, policy](const long long /*value*/) {
+            return lz::transaccumulate(policy, lz::take(values, 64), 0LL, [](const long long i) { return i; });
+        });
+        CHECK(nested == 1000LL * (64LL * 65 / 2));
+
+        CHECK_THROWS_AS(lz::transaccumulate(policy, values, 0LL, [](const long long value) -> long long {
+            if (value == 999) {
+                throw std::runtime_error("chunk failed");
+            }
+            return value;
+        }), std::runtime_error);
+    }
+}
+
+
+TEST_CASE("For each chunk") {
+    auto collect = [](const auto& iterable) {
+        using ValueType = typename std::decay_t<decltype(iterable)>::value_type;
+        std::vector<ValueType> result;
+        lz::forEachChunk(iterable, [&result](const ValueType* data, const std::size_t count) {
+            CHECK(count > 0);
+            result.insert(result.end(), data, data + count);
+        });
+        return result;
+    };
+
+    SECTION("Range and repeat") {
+        CHECK(collect(lz::range(5000)) == lz::range(5000).toVector());
+        CHECK(collect(lz::range(10, -3, -4)) == std::vector<int>{10, 6, 2, -2});
+        CHECK(collect(lz::range(0., 1., .25)) == std::vector<double>{0., .25, .5, .75});
+        CHECK(collect(lz::repeat(3, 1000)) == std::vector<int>(1000, 3));
+        CHECK(collect(lz::range(0)).empty());
+    }
+
+    SECTION("Map and filter") {
+        auto squares = lz::map(lz::range(3000), [](const int i) { return i * i; });
+        CHECK(collect(squares) == squares.toVector());
+
+        std::vector<int> vec = lz::range(3000).toVector();
+        auto even = lz::filter(vec, [](const int i) { return i % 2 == 0; });
+        CHECK(collect(even) == even.toVector());
+
+        std::vector<std::string> strings = {"a", "bb", "c", "dd"};
+        auto longer = lz::filter(strings, [](const std::string& s) { return s.size() > 1; });
+        CHECK(collect(longer) == std::vector<std::string>{"bb", "dd"});
+    }
+
+    SECTION("Concatenate and zip") {
+        std::vector<int> a = {1, 2, 3};
+        std::list<int> b = {4, 5};
+        std::vector<int> c = {6};
+        CHECK(collect(lz::concat(a, b, c)) == std::vector<int>{1, 2, 3, 4, 5, 6});
+
+        auto zipped = lz::zip(a, c);
+        CHECK(collect(zipped) == zipped.toVector());
+    }
+
+    SECTION("Views and containers") {
+        std::list<int> list = {1, 2, 3};
+        CHECK(collect(list) == std::vector<int>{1, 2, 3});
+
+        long long sum = 0;
+        lz::map(lz::range(1000), [](const int i) { return i * 2; }).forEachChunk([&sum](const int* data, const std::size_t count) {
+            sum = std::accumulate(data, data + count, sum);
+        });
+        CHECK(sum == 999000);
+    }
 }
\ No newline at end of file
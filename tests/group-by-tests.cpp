@@ -0,0 +1,96 @@
+#include <Lz/GroupBy.hpp>
+#include <Lz/Concatenate.hpp>
+#include <list>
+#include <catch.hpp>
+
+
+TEST_CASE("GroupBy changing and creating elements", "[GroupBy][Basic functionality]") {
+    std::vector<std::string> words = {"apple", "avocado", "banana", "cherry", "cranberry", "coconut"};
+    auto groups = lz::groupBySorted(words, [](const std::string& s) { return s[0]; });
+    auto begin = groups.begin();
+
+    SECTION("Should group consecutive elements") {
+        REQUIRE(begin->first == 'a');
+        CHECK(begin->second.size() == 2);
+        CHECK(begin->second.toVector() == std::vector<std::string>{"apple", "avocado"});
+    }
+
+    SECTION("Should not copy the elements") {
+        *begin->second.begin() = "apricot";
+        CHECK(words[0] == "apricot");
+    }
+
+    SECTION("Should split groups that are not next to each other") {
+        std::list<int> list = {1, 1, 2, 1};
+        std::vector<int> keys;
+        std::vector<std::size_t> sizes;
+        for (const auto& group : lz::groupBySorted(list, [](const int i) { return i; })) {
+            keys.push_back(group.first);
+            sizes.push_back(group.second.size());
+        }
+        CHECK(keys == std::vector<int>{1, 2, 1});
+        CHECK(sizes == std::vector<std::size_t>{2, 1, 1});
+    }
+
+    SECTION("Empty sequence") {
+        std::vector<int> empty;
+        auto emptyGroups = lz::groupBySorted(empty, [](const int i) { return i; });
+        CHECK(emptyGroups.begin() == emptyGroups.end());
+    }
+}
+
+TEST_CASE("GroupBy binary operations", "[GroupBy][Binary ops]") {
+    std::vector<int> vec = {1, 1, 2, 3, 3, 3};
+    auto groups = lz::groupBySorted(vec, [](const int i) { return i; });
+    auto begin = groups.begin();
+
+    SECTION("Operator++") {
+        ++begin;
+        CHECK(begin->first == 2);
+        CHECK((*begin).second.size() == 1);
+        begin++;
+        CHECK(begin->first == 3);
+        CHECK(begin->second.size() == 3);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(begin != groups.end());
+        ++begin, ++begin, ++begin;
+        CHECK(begin == groups.end());
+    }
+}
+
+TEST_CASE("GroupBy and aggregateBy over unsorted sequences", "[GroupBy][To container]") {
+    std::vector<int> v1 = {3, 1, 4, 1};
+    std::vector<int> v2 = {5, 9, 2, 6};
+    auto concat = lz::concat(v1, v2);
+    auto parity = [](const int i) { return i % 2 == 0; };
+
+    SECTION("Group by") {
+        lz::FlatHashMap<bool, std::vector<int>> groups = lz::groupBy(concat, parity);
+        REQUIRE(groups.size() == 2);
+        CHECK(groups.begin()->first == false);
+        CHECK(groups.at(false) == std::vector<int>{3, 1, 1, 5, 9});
+        CHECK(groups.at(true) == std::vector<int>{4, 2, 6});
+    }
+
+    SECTION("Aggregate by") {
+        auto counts = lz::aggregateBy(concat, parity, 0, [](const int count, const int) { return count + 1; });
+        CHECK(counts.at(false) == 5);
+        CHECK(counts.at(true) == 3);
+
+        auto sums = lz::aggregateBy(concat, parity, 0L, [](const long sum, const int i) { return sum + i; });
+        CHECK(sums.at(false) == 19);
+        CHECK(sums.at(true) == 12);
+
+        auto maxima = lz::aggregateBy(concat, parity, 0, [](const int max, const int i) { return std::max(max, i); });
+        CHECK(maxima.at(false) == 9);
+        CHECK(maxima.at(true) == 6);
+    }
+
+    SECTION("Empty sequence") {
+        std::vector<int> empty;
+        CHECK(lz::groupBy(empty, parity).empty());
+        CHECK(lz::aggregateBy(empty, parity, 0, std::plus<int>()).empty());
+    }
+}
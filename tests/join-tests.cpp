@@ -1,6 +1,7 @@
 #include <catch.hpp>
 #include <Lz/Join.hpp>
 #include <iostream>
+#include <sstream>
 
 
 TEST_CASE("Join should convert to string", "[Join][Basic functionality]") {
@@ -117,3 +118,45 @@ TEST_CASE("Join binary operations", "[Join][Binary ops]") {
         CHECK(joinStrBegin + joinStrDistance - 1 >= joinStrEnd - 1);
     }
 }
+
+TEST_CASE("Join to a string or buffer", "[Join][Basic functionality]") {
+    std::vector<int> v = {1, -2, 3};
+    std::vector<std::string> s = {"h", "e", "l", "l", "o"};
+
+    SECTION("To a string") {
+        std::string ints = "ints: ";
+        lz::joinTo(v, ints, ", ");
+        CHECK(ints == "ints: 1, -2, 3");
+
+        std::string strings;
+        lz::joinTo(s, strings, "");
+        CHECK(strings == "hello");
+    }
+
+    SECTION("To a memory buffer") {
+        fmt::memory_buffer buffer;
+        lz::joinTo(std::vector<double>{1.5, 2}, buffer, " | ");
+        CHECK(fmt::to_string(buffer) == "1.5 | 2");
+    }
+
+    SECTION("To an output iterator") {
+        std::vector<char> chars = {'a', 'b', 'c'};
+        std::ostringstream stream;
+        auto end = lz::joinTo(chars, std::ostreambuf_iterator<char>(stream), "-");
+        static_cast<void>(end);
+        CHECK(stream.str() == "a-b-c");
+    }
+
+    SECTION("Same text as join") {
+        std::string joined;
+        lz::joinTo(v, joined, ", ");
+        CHECK(joined == lz::join(v, ", ").toString());
+    }
+
+    SECTION("Empty") {
+        std::string empty;
+        lz::joinTo(std::vector<int>(), empty, ", ");
+        CHECK(empty.empty());
+    }
+}
+
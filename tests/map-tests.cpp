@@ -3,6 +3,7 @@
 #include <catch.hpp>
 
 #include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
 
 
 struct TestStruct {
@@ -10,6 +11,10 @@ struct TestStruct {
     int testFieldInt;
 };
 
+static std::string getTestFieldStr(const TestStruct& t) {
+    return t.testFieldStr;
+}
+
 
 TEST_CASE("Map changing and creating elements", "[Map][Basic functionality]") {
     constexpr size_t size = 3;
@@ -30,6 +35,14 @@ TEST_CASE("Map changing and creating elements", "[Map][Basic functionality]") {
         CHECK(*(++it) == "FieldC");
     }
 
+    SECTION("Should accept free functions") {
+        auto map = lz::map(array, getTestFieldStr);
+
+        auto it = map.begin();
+        CHECK(*it == "FieldA");
+        CHECK(*(++it) == "FieldB");
+    }
+
     SECTION("Should be by reference") {
         size_t count = 0;
         auto map = lz::map(array, [&count, &array](TestStruct& t) -> std::string& {
@@ -37,6 +50,21 @@ TEST_CASE("Map changing and creating elements", "[Map][Basic functionality]") {
             return t.testFieldStr;
         });
     }
+
+    SECTION("Stateless lambdas take up no space") {
+        auto stateless = [](const TestStruct& t) { return t.testFieldInt; };
+        using Container = lz::detail::FunctionContainer<decltype(stateless)>;
+        CHECK(sizeof(Container) == 1);
+
+        // Captureless lambdas are only default constructible since C++20, the container must not invent a default state
+        static_assert(std::is_default_constructible<Container>::value ==
+                      std::is_default_constructible<decltype(stateless)>::value, "no default state for the lambda");
+
+        Container container(stateless);
+        Container assigned(stateless);
+        assigned = container;
+        CHECK(assigned(array[1]) == 2);
+    }
 }
 
 
@@ -126,6 +154,14 @@ TEST_CASE("Map to containers", "[Map][To container]") {
         }
     }
 
+    SECTION("To vector in parallel") {
+        auto squares = lz::map(lz::range(1000), [](const int i) { return i * i; });
+        std::vector<int> actual = squares.toVector(lz::ParallelPolicy(4, 10));
+
+        CHECK(actual == squares.toVector());
+        CHECK(map.toVector(lz::par).size() == size);
+    }
+
     SECTION("To other container using to<>()") {
         auto stringList = map.to<std::list>();
         auto listIterator = stringList.begin();
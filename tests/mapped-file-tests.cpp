@@ -0,0 +1,71 @@
+#include <cstdio>
+#include <fstream>
+#include <system_error>
+
+#include <catch.hpp>
+#include <Lz/MappedFile.hpp>
+#include <Lz/FunctionTools.hpp>
+#include <Lz/StringSplitter.hpp>
+
+
+namespace {
+    const char* writeFile(const char* path, const std::string& contents) {
+        std::ofstream file(path, std::ios::binary);
+        file << contents;
+        return path;
+    }
+}
+
+
+TEST_CASE("Mapped file changing and creating elements", "[Mapped file][Basic functionality]") {
+    const std::string contents = "hello\nworld\nlazy";
+    const char* path = writeFile("lz-mapped-file-test.txt", contents);
+
+    lz::MappedFile file = lz::mmapFile(path);
+
+    SECTION("Should contain the file") {
+        CHECK(file.size() == contents.size());
+        CHECK(std::string(file.begin(), file.end()) == contents);
+        CHECK(file[6] == 'w');
+    }
+
+    SECTION("Should be viewable on every standard") {
+        lz::StringView view = file.view();
+        CHECK(view.size() == contents.size());
+        CHECK(view.data() == file.begin());
+        CHECK(std::string(view.data(), view.size()) == contents);
+    }
+
+    SECTION("Should be splittable without copying") {
+        std::vector<lz::StringView> expected = {"hello", "world", "lazy"};
+        CHECK(lz::lines(file).toVector() == expected);
+        CHECK(lz::lines(file).begin()->data() == file.begin());
+        CHECK(lz::split(file, "o").toVector().size() == 3);
+    }
+
+    SECTION("Should be movable") {
+        lz::MappedFile moved = std::move(file);
+        CHECK(moved.size() == contents.size());
+        CHECK(file.size() == 0);
+        CHECK(file.begin() == file.end());
+    }
+
+    SECTION("Should throw on a missing file") {
+        CHECK_THROWS_AS(lz::mmapFile("lz-file-that-does-not-exist.txt"), std::system_error);
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE("Mapped file of an empty file", "[Mapped file][Edge cases]") {
+    const char* path = writeFile("lz-mapped-file-empty.txt", "");
+
+    {
+        lz::MappedFile file = lz::mmapFile(path);
+        CHECK(file.size() == 0);
+        CHECK(file.begin() == file.end());
+        CHECK(lz::lines(file).toVector().empty());
+    }
+
+    std::remove(path);
+}
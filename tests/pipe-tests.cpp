@@ -0,0 +1,66 @@
+#include <list>
+#include <vector>
+
+#include <catch.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <Lz/Take.hpp>
+
+
+namespace {
+    int negate(const int i) {
+        return -i;
+    }
+}
+
+TEST_CASE("Pipe adaptors", "[Pipe][Basic functionality]") {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto timesTwo = [](const int i) { return i * 2; };
+    auto plusOne = [](const int i) { return i + 1; };
+    auto isEven = [](const int i) { return i % 2 == 0; };
+    auto isNotDivisibleBy3 = [](const int i) { return i % 3 != 0; };
+
+    SECTION("Should be the same as the functions") {
+        CHECK((vec | lz::map(timesTwo)).toVector() == lz::map(vec, timesTwo).toVector());
+        CHECK((vec | lz::filter(isEven)).toVector() == lz::filter(vec, isEven).toVector());
+        CHECK((vec | lz::take(3)).toVector() == std::vector<int>{1, 2, 3});
+        CHECK((lz::range(5) | lz::map(plusOne)).toVector() == std::vector<int>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("Should fuse map stages") {
+        auto mapped = vec | lz::map(timesTwo) | lz::map(plusOne);
+        CHECK(std::is_same<typename decltype(mapped)::iterator::value_type, int>::value);
+        CHECK(mapped.toVector() == std::vector<int>{3, 5, 7, 9, 11, 13, 15, 17, 19, 21});
+        // One Map over the iterators of vec, not a Map over the iterators of another Map
+        CHECK(std::is_same<decltype(mapped), lz::Map<std::vector<int>::iterator,
+                                                     lz::detail::ComposedFunction<decltype(timesTwo), decltype(plusOne)>>>::value);
+    }
+
+    SECTION("Should fuse filter stages") {
+        auto filtered = vec | lz::filter(isEven) | lz::filter(isNotDivisibleBy3);
+        CHECK(filtered.toVector() == std::vector<int>{2, 4, 8, 10});
+        CHECK(std::is_same<decltype(filtered), lz::Filter<std::vector<int>::iterator,
+                                                          lz::detail::ConjoinedPredicate<decltype(isEven),
+                                                                                         decltype(isNotDivisibleBy3)>>>::value);
+    }
+
+    SECTION("Should combine different stages") {
+        auto pipeline = vec | lz::map(timesTwo) | lz::map(plusOne) | lz::filter(isNotDivisibleBy3) | lz::take(3);
+        CHECK(pipeline.toVector() == std::vector<int>{5, 7, 11});
+
+        std::list<int> list = {1, 2, 3, 4};
+        CHECK((list | lz::filter(isEven) | lz::map(timesTwo)).toVector() == std::vector<int>{4, 8});
+    }
+
+    SECTION("Should fuse plain functions") {
+        CHECK((vec | lz::take(2) | lz::map(negate) | lz::map(negate)).toVector() == std::vector<int>{1, 2});
+        CHECK((lz::map(vec, negate) | lz::map(timesTwo)).toVector().back() == -20);
+    }
+
+    SECTION("Should keep the adaptor reusable") {
+        auto square = lz::map([](const int i) { return i * i; });
+        CHECK((vec | lz::take(3) | square).toVector() == std::vector<int>{1, 4, 9});
+        CHECK((lz::range(2) | square).toVector() == std::vector<int>{0, 1});
+    }
+}
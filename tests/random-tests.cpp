@@ -1,9 +1,11 @@
+#include <Lz/Map.hpp>
 #include <Lz/Random.hpp>
 
 #include <catch.hpp>
 
 #include <iostream>
 #include <list>
+#include <algorithm>
 
 
 TEST_CASE("Random should be random", "[Random][Basic functionality]") {
@@ -22,6 +24,56 @@ TEST_CASE("Random should be random", "[Random][Basic functionality]") {
     }
 }
 
+TEST_CASE("Random seeds, bounds and engines", "[Random][Basic functionality]") {
+    constexpr size_t size = 1000;
+
+    SECTION("Same seed, same sequence") {
+        CHECK(lz::random(0, 1000, size, 42).toVector() == lz::random(0, 1000, size, 42).toVector());
+        CHECK(lz::random(0, 1000, size, 42).toVector() != lz::random(0, 1000, size, 43).toVector());
+    }
+
+    SECTION("Stays within bounds") {
+        for (const int i : lz::random(-3, 3, size)) {
+            CHECK((i >= -3 && i <= 3));
+        }
+        for (const double d : lz::random(-1., 1., size)) {
+            CHECK((d >= -1. && d < 1.));
+        }
+        // Seeded, as an unseeded sequence misses a given value with a probability of about 2%
+        auto bytes = lz::random<std::uint8_t>(0, 255, size, 42).toVector();
+        CHECK(std::find(bytes.begin(), bytes.end(), 255) != bytes.end());
+    }
+
+    SECTION("Fill") {
+        std::vector<int> ints(size);
+        lz::random(10, 20, size).fill(ints.begin(), ints.size());
+        CHECK(std::all_of(ints.begin(), ints.end(), [](const int i) { return i >= 10 && i <= 20; }));
+
+        std::vector<float> floats(size);
+        lz::random(0.f, 1.f, size, 7).fill(floats.begin(), floats.size());
+        CHECK(std::all_of(floats.begin(), floats.end(), [](const float f) { return f >= 0.f && f < 1.f; }));
+    }
+
+    SECTION("Seeded temporaries can be composed") {
+        auto doubled = lz::map(lz::random(0, 1000, 5, 42), [](const int i) { return i * 2; });
+        std::vector<int> expected = lz::random(0, 1000, 5, 42).toVector();
+        for (int& i : expected) {
+            i *= 2;
+        }
+
+        std::vector<int> actual;
+        for (const int i : doubled) {
+            actual.push_back(i);
+        }
+        CHECK(actual == expected);
+    }
+
+    SECTION("Other engines") {
+        auto random = lz::random<int, std::mt19937>(0, 10, size, 1);
+        CHECK(random.toVector() == lz::random<int, std::mt19937>(0, 10, size, 1).toVector());
+    }
+}
+
 TEST_CASE("Random binary operations", "[Random][Binary ops]") {
     constexpr size_t size = 5;
     auto random = lz::random(0., 1., size);
@@ -1,3 +1,4 @@
+#include <limits>
 #include <list>
 
 #include <catch.hpp>
@@ -14,6 +15,13 @@ TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]"
         }
     }
 
+    SECTION("Usable in constant expressions") {
+        constexpr auto range = lz::range(3, 9, 2);
+        static_assert(*range.begin() == 3, "range should start at 3");
+        static_assert(range.end() - range.begin() == 3, "range should have 3 elements");
+        static_assert(range.begin()[2] == 7, "range should have 7 as last element");
+    }
+
     SECTION("Looping backwards") {
         int expectedCounter = 5;
 
@@ -41,6 +49,64 @@ TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]"
         }
     }
 
+    SECTION("Floating point ranges do not accumulate errors") {
+        auto range = lz::range(0., 1., .1);
+        CHECK(range.size() == 10);
+
+        std::vector<double> actual = range.toVector();
+        REQUIRE(actual.size() == 10);
+        for (std::size_t i = 0; i < actual.size(); i++) {
+            CHECK(actual[i] == static_cast<double>(i) * .1);
+        }
+
+        std::size_t count = 0;
+        for (const double d : range) {
+            CHECK(d == static_cast<double>(count) * .1);
+            count++;
+        }
+        CHECK(count == 10);
+
+        std::vector<double> chunked;
+        range.forEachChunk([&chunked](const double* data, const std::size_t size) {
+            chunked.insert(chunked.end(), data, data + size);
+        });
+        CHECK(chunked == actual);
+        CHECK(range.begin()[7] == 7 * .1);
+        CHECK(*(range.end() - 1) == 9 * .1);
+        CHECK(lz::range(1., 0., -.1).size() == 10);
+    }
+
+    SECTION("Integral ranges near the limits of their type") {
+        auto wide = lz::range(-2000000000, 2000000000, 1000000000);
+        CHECK(wide.size() == 4);
+        CHECK(wide.toVector() == std::vector<int>{-2000000000, -1000000000, 0, 1000000000});
+        CHECK(*(wide.end() - 1) == 1000000000);
+
+        auto backwards = lz::range(2000000000, -2000000000, -1000000000);
+        CHECK(backwards.toVector() == std::vector<int>{2000000000, 1000000000, 0, -1000000000});
+
+        constexpr int min = std::numeric_limits<int>::min();
+        constexpr int max = std::numeric_limits<int>::max();
+        CHECK(lz::range(min, max, 1 << 30).toVector() == std::vector<int>{min, -(1 << 30), 0, 1 << 30});
+
+        // The value after the last one does not fit in an int
+        auto top = lz::range(max - 10, max, 3);
+        CHECK(top.toVector() == std::vector<int>{max - 10, max - 7, max - 4, max - 1});
+        std::vector<int> iterated;
+        for (const int i : top) {
+            iterated.push_back(i);
+        }
+        CHECK(iterated == top.toVector());
+
+        auto shorts = lz::range(static_cast<short>(-30000), static_cast<short>(30000), static_cast<short>(20000));
+        CHECK(shorts.size() == 3);
+        CHECK(shorts.toVector() == std::vector<short>{-30000, -10000, 10000});
+
+        constexpr short maxShort = std::numeric_limits<short>::max();
+        auto topShorts = lz::range(static_cast<short>(maxShort - 5), maxShort, static_cast<short>(4));
+        CHECK(topShorts.toVector() == std::vector<short>{maxShort - 5, maxShort - 1});
+    }
+
     SECTION("Exceptions") {
         CHECK_THROWS(lz::range(0, 10, -1));
         CHECK_THROWS(lz::range(-10, -20, 1));
@@ -123,6 +189,15 @@ TEST_CASE("Range to containers", "[Range][To container]") {
         CHECK(expected == actual);
     }
 
+    SECTION("Size hint is exact") {
+        CHECK(range.sizeHint().kind == lz::detail::SizeHintKind::Exact);
+        CHECK(range.sizeHint().size == static_cast<size_t>(size));
+        CHECK(lz::range(3, 10, 2).sizeHint().size == 4);
+        CHECK(lz::range(10, 3, -2).sizeHint().size == 4);
+        CHECK(lz::range(0.0, 1.0, 0.25).sizeHint().size == 4);
+        CHECK(lz::range(3, 10, 2).size() == 4);
+    }
+
     SECTION("To other container using to<>()") {
         std::list<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
         auto actual = range.to<std::list>();
@@ -151,4 +226,12 @@ TEST_CASE("Range to containers", "[Range][To container]") {
 
         CHECK(expected == actual);
     }
+
+    SECTION("To string") {
+        CHECK(range.toString() == "0123456789");
+        CHECK(range.toString(", ") == "0, 1, 2, 3, 4, 5, 6, 7, 8, 9");
+        CHECK(lz::range(-3, 0).toString(" -> ") == "-3 -> -2 -> -1");
+        CHECK(lz::range(0).toString(", ").empty());
+        CHECK(lz::range(0., 1.5, .5).toString(" ") == "0 0.5 1");
+    }
 }
@@ -0,0 +1,170 @@
+#include <sstream>
+#include <streambuf>
+
+#include <catch.hpp>
+#include <Lz/Arena.hpp>
+#include <Lz/StreamSplitter.hpp>
+#include <Lz/StringSplitter.hpp>
+
+
+TEST_CASE("Stream splitter changing and creating elements", "[Stream splitter][Basic functionality]") {
+    std::istringstream stream("Hello  world  test  123  ");
+    auto splitter = lz::splitStream(stream, "  ", 4);
+
+    SECTION("Should split on delimiter") {
+        std::vector<std::string> expected = {"Hello", "world", "test", "123"};
+        std::vector<std::string> actual;
+
+        for (auto&& substring : splitter) {
+            actual.emplace_back(substring);
+        }
+        CHECK(actual == expected);
+    }
+
+    SECTION("Should be lz::StringView") {
+        CHECK(std::is_same<decltype(*splitter.begin()), lz::StringView>::value);
+    }
+
+    SECTION("Should be std::string if requested") {
+        std::istringstream other("a b");
+        CHECK(std::is_same<decltype(*lz::splitStream<std::string>(other, " ").begin()), std::string&>::value);
+    }
+}
+
+// Hands out one piece at a time, like a pipe that receives a line at a time
+class PieceBuffer : public std::streambuf {
+    std::vector<std::string> _pieces;
+    std::size_t _next{};
+
+protected:
+    int_type underflow() override {
+        if (_next == _pieces.size()) {
+            return traits_type::eof();
+        }
+        std::string& piece = _pieces[_next++];
+        setg(&piece[0], &piece[0], &piece[0] + piece.size());
+        return traits_type::to_int_type(piece[0]);
+    }
+
+public:
+    explicit PieceBuffer(std::vector<std::string> pieces) :
+        _pieces(std::move(pieces)) {
+    }
+
+    std::size_t piecesRead() const {
+        return _next;
+    }
+};
+
+TEST_CASE("Stream splitter only reads what is available", "[Stream splitter][Basic functionality]") {
+    PieceBuffer buffer({"first,sec", "ond,", "third"});
+    std::istream stream(&buffer);
+    auto splitter = lz::splitStream(stream, ",");
+
+    auto it = splitter.begin();
+    CHECK(*it == "first");
+    CHECK(buffer.piecesRead() == 1);
+
+    ++it;
+    CHECK(*it == "second");
+    CHECK(buffer.piecesRead() == 2);
+
+    ++it;
+    CHECK(*it == "third");
+    ++it;
+    CHECK(it == splitter.end());
+}
+
+// Hands out one character at a time and cannot tell how many are available, like std::cin synchronized with stdio
+class UnbufferedBuffer : public std::streambuf {
+    std::string _contents;
+    std::size_t _position{};
+    std::size_t _reads{};
+
+protected:
+    int_type underflow() override {
+        return _position == _contents.size() ? traits_type::eof() : traits_type::to_int_type(_contents[_position]);
+    }
+
+    int_type uflow() override {
+        return _position == _contents.size() ? traits_type::eof() : traits_type::to_int_type(_contents[_position++]);
+    }
+
+    std::streamsize showmanyc() override {
+        return 0;
+    }
+
+    std::streamsize xsgetn(char_type* s, const std::streamsize count) override {
+        ++_reads;
+        return std::streambuf::xsgetn(s, count);
+    }
+
+public:
+    explicit UnbufferedBuffer(std::string contents) :
+        _contents(std::move(contents)) {
+    }
+
+    std::size_t reads() const {
+        return _reads;
+    }
+};
+
+TEST_CASE("Stream splitter reads whole chunks if nothing is known to be available", "[Stream splitter][Edge cases]") {
+    std::string contents;
+    for (int i = 0; i < 100; i++) {
+        contents += std::to_string(i) + "\n";
+    }
+    UnbufferedBuffer buffer(contents);
+    std::istream stream(&buffer);
+    constexpr std::size_t chunkSize = 64;
+
+    auto lines = lz::splitStream<std::string>(stream, "\n", chunkSize).toVector();
+    REQUIRE(lines.size() == 100);
+    CHECK(lines[42] == "42");
+    CHECK(buffer.reads() <= contents.size() / chunkSize + 2);
+}
+
+TEST_CASE("Stream splitter with an allocator", "[Stream splitter][Basic functionality]") {
+    alignas(std::max_align_t) char buffer[1024];
+    lz::Arena arena(buffer, sizeof buffer);
+    char* const first = static_cast<char*>(arena.allocate(1, 1));
+
+    std::istringstream stream("Hello  world  test  123");
+    auto lines = lz::splitStream<std::string>(stream, "  ", 64, lz::ArenaAllocator<char>(arena)).toVector();
+    CHECK(lines == std::vector<std::string>{"Hello", "world", "test", "123"});
+
+    char* const next = static_cast<char*>(arena.allocate(1, 1));
+    CHECK(next - first >= 64);
+    CHECK(next - buffer < static_cast<std::ptrdiff_t>(sizeof buffer));
+}
+
+TEST_CASE("Stream splitter on chunk boundaries", "[Stream splitter][Edge cases]") {
+    std::string toSplit;
+    for (std::size_t i = 0; i < 100; i++) {
+        toSplit += std::string(i % 13, static_cast<char>('a' + i % 26)) + "<->";
+    }
+    toSplit += "last";
+
+    for (const std::size_t chunkSize : {1, 2, 3, 5, 64, 4096}) {
+        for (const std::string delimiter : {"<->", "-", ">"}) {
+            std::istringstream stream(toSplit);
+            auto expected = lz::split<std::string>(toSplit, delimiter).toVector();
+
+            CHECK(lz::splitStream<std::string>(stream, delimiter, chunkSize).toVector() == expected);
+        }
+    }
+}
+
+TEST_CASE("Stream splitter empty and delimiter only streams", "[Stream splitter][Edge cases]") {
+    SECTION("Empty stream") {
+        std::istringstream stream;
+        auto splitter = lz::splitStream(stream, "\n");
+        CHECK(splitter.begin() == splitter.end());
+    }
+
+    SECTION("Leading and trailing delimiters") {
+        std::istringstream stream("\na\n\nb\n");
+        std::vector<std::string> expected = {"", "a", "", "b"};
+        CHECK(lz::splitStream<std::string>(stream, "\n", 2).toVector() == expected);
+    }
+}
@@ -19,22 +19,57 @@ TEST_CASE("String splitter changing and creating elements", "[String splitter][B
         }
     }
 
-#ifdef CXX_LT_17
-    SECTION("Should be std::string") {
-        CHECK(std::is_same<decltype(*it), std::string&>::value);
+    SECTION("Should be lz::StringView") {
+        CHECK(std::is_same<decltype(*it), lz::StringView>::value);
+#ifndef CXX_LT_17
+        CHECK(std::is_same<lz::StringView, std::string_view>::value);
+#endif
+    }
+
+    SECTION("Should contain lz::StringView correctly") {
+        std::vector<lz::StringView> actual = splitter.toVector();
+        std::vector<lz::StringView> expected = {"Hello", "world", "test", "123"};
+
+        CHECK(actual == expected);
+        CHECK(actual.front().data() == toSplit.data());
+    }
+
+    SECTION("Should copy when std::string is specified") {
+        CHECK(std::is_same<decltype(*lz::split<std::string>(toSplit, " ").begin()), std::string&>::value);
+    }
+}
+
+TEST_CASE("String splitter on long strings", "[String splitter][Basic functionality]") {
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 100; i++) {
+        expected.push_back(std::string(i % 70, static_cast<char>('a' + i % 26)));
     }
-#else
-    SECTION("Should be std::string_view") {
-        CHECK(std::is_same<decltype(*it), std::string_view>::value);
+
+    SECTION("Single character delimiter") {
+        std::string toSplit;
+        for (const std::string& s : expected) {
+            toSplit += s + '\n';
+        }
+
+        std::vector<std::string> actual;
+        for (const auto& s : lz::split(toSplit, "\n")) {
+            actual.emplace_back(s.data(), s.size());
+        }
+        CHECK(actual == expected);
     }
 
-    SECTION("Should contain std::string_view correctly") {
-        std::vector<std::string_view> actual = splitter.toVector();
-        std::vector<std::string_view> expected = {"Hello", "world", "test", "123"};
+    SECTION("Multi character delimiter") {
+        std::string toSplit;
+        for (const std::string& s : expected) {
+            toSplit += s + ", ";
+        }
 
+        std::vector<std::string> actual;
+        for (const auto& s : lz::split(toSplit, ", ")) {
+            actual.emplace_back(s.data(), s.size());
+        }
         CHECK(actual == expected);
     }
-#endif
 }
 
 TEST_CASE("String splitter binary operations", "[String splitter][Binary ops]") {
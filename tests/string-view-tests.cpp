@@ -0,0 +1,70 @@
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+#include <catch.hpp>
+#include <Lz/StringView.hpp>
+
+
+TEST_CASE("String view basic functionality", "[String view][Basic functionality]") {
+    std::string string = "hello world";
+    lz::StringView view = string;
+
+    SECTION("Should point into the string") {
+        CHECK(view.data() == string.data());
+        CHECK(view.size() == string.size());
+        CHECK(view[4] == 'o');
+        CHECK(view.front() == 'h');
+        CHECK(view.back() == 'd');
+        CHECK(std::string(view.begin(), view.end()) == string);
+    }
+
+    SECTION("Substrings") {
+        CHECK(view.substr(6) == "world");
+        CHECK(view.substr(0, 5) == "hello");
+        CHECK(view.substr(6, 100) == "world");
+        CHECK(view.substr(11).empty());
+        CHECK_THROWS_AS(view.substr(12), std::out_of_range);
+
+        lz::StringView trimmed = view;
+        trimmed.remove_prefix(1);
+        trimmed.remove_suffix(1);
+        CHECK(trimmed == "ello worl");
+    }
+
+    SECTION("Comparison") {
+        CHECK(view == "hello world");
+        CHECK(view != "hello");
+        CHECK(lz::StringView("abc") < lz::StringView("abd"));
+        CHECK(lz::StringView("ab") < lz::StringView("abc"));
+        CHECK(lz::StringView("abc") >= lz::StringView("abc"));
+        CHECK(lz::StringView("b") > lz::StringView("abc"));
+        CHECK(view.compare(string) == 0);
+    }
+
+    SECTION("Find") {
+        CHECK(view.find('o') == 4);
+        CHECK(view.find('o', 5) == 7);
+        CHECK(view.find('z') == std::string::npos);
+    }
+
+    SECTION("Conversions") {
+        CHECK(static_cast<std::string>(view) == string);
+
+        std::ostringstream stream;
+        stream << view.substr(0, 5);
+        CHECK(stream.str() == "hello");
+        CHECK(fmt::format("[{:>6}]", view.substr(6)) == "[ world]");
+    }
+}
+
+TEST_CASE("String view to containers", "[String view][To container]") {
+    SECTION("As a key") {
+        std::unordered_set<lz::StringView> set = {"a", "b", "a"};
+        CHECK(set.size() == 2);
+        CHECK(set.count("b") == 1);
+
+        std::map<lz::StringView, int> map = {{"b", 2}, {"a", 1}};
+        CHECK(map.begin()->first == "a");
+    }
+}
@@ -73,6 +73,10 @@ TEST_CASE("TakeEvery binary operations", "[TakeEvery][Binary ops]") {
 
     SECTION("Operator-(Iterator)") {
         CHECK(takeEvery.end() - takeEvery.begin() == 2);
+
+        std::array<int, 3> three = {1, 2, 3};
+        auto everyOther = lz::takeevery(three, 2);
+        CHECK(everyOther.end() - everyOther.begin() == 2);
     }
 
     SECTION("Operator[]()") {
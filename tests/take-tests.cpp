@@ -1,6 +1,8 @@
 #include <list>
+#include <sstream>
 
 #include <catch.hpp>
+#include <Lz/Map.hpp>
 #include <Lz/Take.hpp>
 
 
@@ -38,6 +40,35 @@ TEST_CASE("Take changing and creating elements", "[Take][Basic functionality]")
         CHECK(it == taken.end());
     }
 
+    SECTION("Should be a plain view over the iterators of the iterable") {
+        std::vector<int> vec(array.begin(), array.end());
+        auto sliced = lz::slice(vec, 2, 7);
+        static_assert(std::is_same<decltype(sliced.begin()), std::vector<int>::iterator>::value,
+                      "take must not wrap the iterator");
+
+        CHECK(sliced.size() == 5);
+        CHECK(sliced[0] == 3);
+        CHECK(sliced[4] == 7);
+        CHECK(&*sliced.begin() == vec.data() + 2);
+        CHECK(lz::takerange(vec.begin() + 1, vec.begin() + 4).size() == 3);
+
+        std::list<int> list(array.begin(), array.end());
+        auto taken = lz::take(list, 4);
+        CHECK(taken.size() == 4);
+        CHECK(taken.toVector() == std::vector<int>{1, 2, 3, 4});
+    }
+
+    SECTION("Should not count the elements of a takerange up front") {
+        std::list<int> list(array.begin(), array.end());
+        auto taken = lz::takerange(std::next(list.begin()), std::prev(list.end()));
+        CHECK(taken.sizeHint().kind == lz::detail::SizeHintKind::Unknown);
+        CHECK(taken.size() == 8);
+
+        std::istringstream stream("1 2 3");
+        auto fromStream = lz::takerange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        CHECK(fromStream.toVector() == std::vector<int>{1, 2, 3});
+    }
+
     SECTION("Should take while range") {
         auto taken = lz::takewhile(array, [](int i) { return i != 5; });
 
@@ -47,6 +78,44 @@ TEST_CASE("Take changing and creating elements", "[Take][Basic functionality]")
             ++expected;
         }
     }
+
+    SECTION("Should take while and compute every mapped value once") {
+        int calls = 0;
+        auto mapped = lz::map(array, [&calls](const int i) {
+            ++calls;
+            return i * 10;
+        });
+        auto taken = lz::takewhile(mapped, [](const int i) { return i != 50; });
+
+        std::vector<int> actual;
+        for (const int i : taken) {
+            actual.push_back(i);
+        }
+        CHECK(actual == std::vector<int>{10, 20, 30, 40});
+        CHECK(calls == 5);
+    }
+}
+
+
+TEST_CASE("Take over contiguous storage", "[Take][Contiguous]") {
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6};
+
+    static_assert(lz::detail::IsContiguous<std::vector<int>::const_iterator>::value, "vector iterators are contiguous");
+    static_assert(lz::detail::IsContiguous<std::string::iterator>::value, "string iterators are contiguous");
+    static_assert(!lz::detail::IsContiguous<std::list<int>::iterator>::value, "list iterators are not contiguous");
+    static_assert(!lz::detail::IsContiguous<std::vector<bool>::iterator>::value, "vector<bool> is not contiguous");
+
+    SECTION("Should expose data") {
+        auto sliced = lz::slice(vec, 1, 4);
+        CHECK(sliced.data() == vec.data() + 1);
+        CHECK(lz::slice(vec, 2, 2).data() == nullptr);
+    }
+
+    SECTION("Should copy to containers") {
+        auto sliced = lz::slice(vec, 1, 4);
+        CHECK(sliced.toVector() == std::vector<int>{2, 3, 4});
+        CHECK(sliced.toArray<3>() == std::array<int, 3>{2, 3, 4});
+    }
 }
 
 
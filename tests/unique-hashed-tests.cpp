@@ -0,0 +1,100 @@
+#include <Lz/UniqueHashed.hpp>
+#include <list>
+#include <sstream>
+#include <catch.hpp>
+
+
+namespace {
+    struct CaseInsensitiveHash {
+        std::size_t operator()(const std::string& s) const {
+            std::string lower;
+            std::transform(s.begin(), s.end(), std::back_inserter(lower), [](const char c) { return std::tolower(c); });
+            return std::hash<std::string>()(lower);
+        }
+    };
+
+    struct CaseInsensitiveEqual {
+        bool operator()(const std::string& a, const std::string& b) const {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const char x, const char y) {
+                return std::tolower(x) == std::tolower(y);
+            });
+        }
+    };
+}
+
+
+TEST_CASE("UniqueHashed changing and creating elements", "[UniqueHashed][Basic functionality]") {
+    std::array<int, 6> arr = {3, 2, 3, 1, 2, 4};
+    auto unique = lz::uniqueHashed(arr);
+    auto beg = unique.begin();
+
+    REQUIRE(*beg == 3);
+
+    SECTION("Should keep the order of first occurrence") {
+        std::vector<int> expected = {3, 2, 1, 4};
+        CHECK(unique.toVector() == expected);
+    }
+
+    SECTION("Should not modify the sequence") {
+        std::array<int, 6> expected = {3, 2, 3, 1, 2, 4};
+        CHECK(arr == expected);
+    }
+
+    SECTION("Should accept a custom hash and equality") {
+        std::vector<std::string> words = {"Hello", "world", "hello", "WORLD", "lazy"};
+        std::vector<std::string> expected = {"Hello", "world", "lazy"};
+        CHECK(lz::uniqueHashed(words, CaseInsensitiveHash(), CaseInsensitiveEqual()).toVector() == expected);
+    }
+}
+
+TEST_CASE("UniqueHashed binary operations", "[UniqueHashed][Binary ops]") {
+    std::array<int, 4> arr = {3, 2, 3, 1};
+    auto unique = lz::uniqueHashed(arr);
+    auto beg = unique.begin();
+
+    SECTION("Operator++") {
+        ++beg;
+        CHECK(*beg == 2);
+        ++beg;
+        CHECK(*beg == 1);
+        ++beg;
+        CHECK(beg == unique.end());
+    }
+
+    SECTION("Operator==, operator!=") {
+        CHECK(beg != unique.end());
+        beg = unique.end();
+        CHECK(beg == unique.end());
+    }
+}
+
+TEST_CASE("UniqueHashed on input iterators and many values", "[UniqueHashed][Edge cases]") {
+    SECTION("Input iterators") {
+        std::istringstream stream("5 1 5 2 1 3");
+        auto unique = lz::uniqueHashedRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        std::vector<int> expected = {5, 1, 2, 3};
+        CHECK(unique.toVector() == expected);
+    }
+
+    SECTION("Many values") {
+        std::vector<int> values;
+        for (int i = 0; i < 10000; i++) {
+            values.push_back((i * 7919) % 1000 * 1024);
+        }
+        CHECK(lz::uniqueHashed(values).toVector().size() == 1000);
+    }
+
+    SECTION("Copies share the values that were seen") {
+        std::vector<int> values = {1, 2, 1, 3, 2, 4};
+        auto unique = lz::uniqueHashed(values);
+        static_assert(std::is_same<decltype(unique.begin())::iterator_category, std::input_iterator_tag>::value,
+                      "UniqueHashed iterators should be input iterators");
+
+        std::vector<int> result;
+        for (auto it = unique.begin(); it != unique.end();) {
+            result.push_back(*it++);
+        }
+        CHECK(result == std::vector<int>{1, 2, 3, 4});
+        CHECK(unique.toVector() == result);
+    }
+}